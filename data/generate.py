@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+# Generation 3 Pokémon Data Structure Generator
+# Copyright © 2017 Ethan Welker (nuew)
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Generate pokegen-data.c, the game data tables, from the *.txt files here.
+# Each table gets a perfect hash of its names (hash and displace), so that
+# name_lookup() finds any name with two hashes and one comparison. Species
+# and moves have columns of data before their names, which become
+# species_info[] and move_pp[]; experience_table[] is computed from the
+# growth rate formulas below. learnsets.txt and origins.txt become the
+# bitsets that pokegen_check() tests.
+#
+# Usage: generate.py <data directory> > pokegen-data.c
+
+import os
+import sys
+
+KEY_MAX = 32  # NAME_KEY_MAX
+
+TABLES = ["species", "items", "moves", "abilities", "locations",
+          "games", "balls", "languages", "growth"]
+
+# Columns between the value and the name of each table that has them
+COLUMNS = {"species": 7, "moves": 1}
+
+SPECIES_COUNT = 413
+MOVES_COUNT = 355
+ITEMS_COUNT = 377
+MAX_LEVEL = 100
+GAMES = 16
+LOCATIONS = 256
+ALWAYS_MET = [254, 255]  # in-game trades and fateful encounters
+
+
+# Experience needed for level n at each growth rate, with the games' integer maths
+def cube(n):
+    return n * n * n
+
+
+GROWTH = {
+    "medium-fast": lambda n: cube(n),
+    "erratic": lambda n: ((100 - n) * cube(n) // 50 if n <= 50 else
+                          (150 - n) * cube(n) // 100 if n <= 68 else
+                          (1911 - 10 * n) // 3 * cube(n) // 500 if n <= 98 else
+                          (160 - n) * cube(n) // 100),
+    "fluctuating": lambda n: (((n + 1) // 3 + 24) * cube(n) // 50 if n <= 15 else
+                              (n + 14) * cube(n) // 50 if n <= 36 else
+                              (n // 2 + 32) * cube(n) // 50),
+    "medium-slow": lambda n: 6 * cube(n) // 5 - 15 * n * n + 100 * n - 140,
+    "fast": lambda n: 4 * cube(n) // 5,
+    "slow": lambda n: 5 * cube(n) // 4,
+}
+
+# Must match name_key() in pokegen.c
+FOLD = {b"\xc3\xa9": b"e", b"\xc3\x89": b"e",
+        b"\xe2\x99\x80": b"f", b"\xe2\x99\x82": b"m"}
+
+
+def normalize(name):
+    raw = name.encode("utf-8")
+    out = bytearray()
+    i = 0
+    while i < len(raw):
+        for seq, c in FOLD.items():
+            if raw.startswith(seq, i):
+                out += c
+                i += len(seq)
+                break
+        else:
+            c = raw[i]
+            if ord("A") <= c <= ord("Z"):
+                out.append(c + 32)
+            elif ord("a") <= c <= ord("z") or ord("0") <= c <= ord("9"):
+                out.append(c)
+            i += 1
+    return bytes(out)
+
+
+# Must match name_hash() in pokegen.c
+def name_hash(key, seed):
+    h = (0x811c9dc5 ^ seed) & 0xffffffff
+    for c in key:
+        h = ((h ^ c) * 0x01000193) & 0xffffffff
+    h ^= h >> 15
+    h = (h * 0x2c1b3c6d) & 0xffffffff
+    h ^= h >> 12
+    return h
+
+
+def read_table(path, columns):
+    entries = []
+    with open(path, encoding="utf-8") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split(None, columns + 1)
+            if len(fields) != columns + 2:
+                sys.exit("%s:%d: expected %d columns and a name" % (path, lineno, columns + 1))
+            entries.append((int(fields[0], 0), fields[-1], lineno, fields[1:-1]))
+    return entries
+
+
+def perfect_hash(keys):
+    size = 1
+    while size < len(keys) * 5 // 4 + 1:
+        size *= 2
+    buckets = max(1, (len(keys) + 2) // 3)
+
+    members = [[] for _ in range(buckets)]
+    for entry, key in enumerate(keys):
+        members[name_hash(key, 0) % buckets].append(entry)
+
+    seeds = [0] * buckets
+    slots = [0] * size
+    for bucket in sorted(range(buckets), key=lambda b: -len(members[b])):
+        if not members[bucket]:
+            continue
+        for seed in range(1, 0x10000):
+            taken = [name_hash(keys[e], seed) & (size - 1) for e in members[bucket]]
+            if len(set(taken)) == len(taken) and all(slots[s] == 0 for s in taken):
+                break
+        else:
+            sys.exit("no perfect hash seed for bucket %d" % bucket)
+        seeds[bucket] = seed
+        for e, s in zip(members[bucket], taken):
+            slots[s] = e + 1
+    return seeds, slots
+
+
+def c_string(name):
+    return '"' + name.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def c_lines(values, per_line, indent="  "):
+    return "".join(indent + ", ".join(values[i:i + per_line]) + ",\n"
+                   for i in range(0, len(values), per_line))
+
+
+def c_array(declaration, values, per_line):
+    return "%s = {\n%s};\n" % (declaration, c_lines(values, per_line))
+
+
+# Bitset of the given bits, as 32 bit words
+def bitset(bits, size):
+    words = [0] * ((size + 31) // 32)
+    for bit in bits:
+        words[bit // 32] |= 1 << (bit % 32)
+    return ["0x%08x" % w for w in words]
+
+
+def lookup(tables, table, name, path, lineno):
+    for value, entry, _, _ in tables[table]:
+        if normalize(entry) == normalize(name):
+            return value
+    sys.exit("%s:%d: unknown %s '%s'" % (path, lineno, table, name))
+
+
+def read_lines(path):
+    with open(path, encoding="utf-8") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if line and not line.startswith("#"):
+                yield lineno, line
+
+
+def print_learnsets(tables, path):
+    learnsets = {}
+    for lineno, line in read_lines(path):
+        species, _, moves = line.partition(":")
+        species = lookup(tables, "species", species.strip(), path, lineno)
+        learnsets[species] = [lookup(tables, "moves", move.strip(), path, lineno)
+                              for move in moves.split(",")]
+
+    print()
+    print(c_array("const uint32_t learnsets_known[BITSET_WORDS(SPECIES_COUNT)]",
+                  bitset(learnsets, SPECIES_COUNT), 6), end="")
+
+    print()
+    print("const uint32_t learnsets[SPECIES_COUNT][BITSET_WORDS(MOVES_COUNT)] = {")
+    for value, name, _, _ in tables["species"]:
+        # Without a learnset, any move can be drawn, and moves aren't checked
+        moves = learnsets.get(value, range(MOVES_COUNT))
+        print("  [%d] = { // %s" % (value, name))
+        print(c_lines(bitset(moves, MOVES_COUNT), 6, "    "), end="")
+        print("  },")
+    print("};")
+
+
+def print_game_rules(tables, path):
+    print()
+    print("const struct GameRules game_rules[GAMES] = {")
+    for lineno, line in read_lines(path):
+        fields = line.split()
+        if len(fields) != 3:
+            sys.exit("%s:%d: expected a game, locations and balls" % (path, lineno))
+        game = lookup(tables, "games", fields[0], path, lineno)
+
+        locations = list(ALWAYS_MET)
+        for span in fields[1].split(","):
+            first, _, last = span.partition("-")
+            locations += range(int(first), int(last or first) + 1)
+        if fields[2] == "all":
+            balls = [value for value, _, _, _ in tables["balls"]]
+        else:
+            balls = [lookup(tables, "balls", ball, path, lineno) for ball in fields[2].split(",")]
+
+        print("  [%d] = { // %s" % (game, fields[0]))
+        print("    .locations = {")
+        print(c_lines(bitset(locations, LOCATIONS), 4, "      "), end="")
+        print("    },")
+        print("    .balls = 0x%04x" % sum(1 << ball for ball in set(balls)))
+        print("  },")
+    print("};")
+
+
+def main():
+    directory = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(sys.argv[0])
+    print("/* Generated by data/generate.py from the data/ tables; do not edit */")
+    print()
+    print('#include "pokegen.h"')
+
+    tables = {}
+    for table in TABLES:
+        path = os.path.join(directory, table + ".txt")
+        entries = read_table(path, COLUMNS.get(table, 0))
+        tables[table] = entries
+        keys = [normalize(name) for _, name, _, _ in entries]
+
+        seen = {}
+        for (_, name, lineno, _), key in zip(entries, keys):
+            if not key or len(key) >= KEY_MAX:
+                sys.exit("%s:%d: '%s' is too short or long a name" % (path, lineno, name))
+            if key in seen:
+                sys.exit("%s:%d: '%s' is the same name as line %d" % (path, lineno, name, seen[key]))
+            seen[key] = lineno
+
+        seeds, slots = perfect_hash(keys)
+        print()
+        print(c_array("static const char *const %s_names[]" % table, [c_string(n) for _, n, _, _ in entries], 4), end="")
+        print(c_array("static const char *const %s_keys[]" % table, [c_string(k.decode()) for k in keys], 6), end="")
+        print(c_array("static const uint16_t %s_values[]" % table, ["0x%x" % v for v, _, _, _ in entries], 10), end="")
+        print(c_array("static const uint16_t %s_seeds[]" % table, [str(s) for s in seeds], 12), end="")
+        print(c_array("static const uint16_t %s_slots[]" % table, [str(s) for s in slots], 16), end="")
+        print("const struct NameTable %s_table = {" % table)
+        print("  %s_names, %s_keys, %s_values, %d," % (table, table, table, len(entries)))
+        print("  %s_seeds, %d, %s_slots, %d" % (table, len(seeds), table, len(slots)))
+        print("};")
+
+    growth = {name: value for value, name, _, _ in tables["growth"]}
+    rates = sorted(growth, key=growth.get)
+    for name in rates:
+        if name not in GROWTH:
+            sys.exit("growth rate '%s' has no formula" % name)
+
+    print()
+    print("const struct SpeciesInfo species_info[SPECIES_COUNT] = {")
+    for value, name, lineno, columns in tables["species"]:
+        if value >= SPECIES_COUNT:
+            sys.exit("species:%d: index %d is past SPECIES_COUNT" % (lineno, value))
+        if columns[6] not in growth:
+            sys.exit("species:%d: unknown growth rate '%s'" % (lineno, columns[6]))
+        hp, attack, defense, special_attack, special_defense, speed = columns[:6]
+        print("  [%d] = {{%s, %s, %s, %s, %s, %s}, %d}, // %s" % (
+            value, hp, attack, defense, speed, special_attack, special_defense,
+            growth[columns[6]], name))
+    print("};")
+
+    print()
+    pp = ["0"] * MOVES_COUNT
+    for value, _, lineno, columns in tables["moves"]:
+        if value >= MOVES_COUNT:
+            sys.exit("moves:%d: index %d is past MOVES_COUNT" % (lineno, value))
+        pp[value] = columns[0]
+    print(c_array("const uint8_t move_pp[MOVES_COUNT]", pp, 20), end="")
+
+    print()
+    print("const uint32_t experience_table[GROWTH_RATES][MAX_LEVEL + 1] = {")
+    for name in rates:
+        levels = ["0", "0"] + [str(GROWTH[name](n)) for n in range(2, MAX_LEVEL + 1)]
+        print("  { // %s" % name)
+        for i in range(0, len(levels), 10):
+            print("    " + ", ".join(levels[i:i + 10]) + ",")
+        print("  },")
+    print("};")
+
+    print()
+    species = [value for value, _, _, columns in tables["species"] if int(columns[0]) != 0]
+    print(c_array("const uint32_t legal_species[BITSET_WORDS(SPECIES_COUNT)]",
+                  bitset(species, SPECIES_COUNT), 6), end="")
+    items = [value for value, _, _, _ in tables["items"]]
+    if max(items) >= ITEMS_COUNT:
+        sys.exit("items: index %d is past ITEMS_COUNT" % max(items))
+    print(c_array("const uint32_t legal_items[BITSET_WORDS(ITEMS_COUNT)]",
+                  bitset(items, ITEMS_COUNT), 6), end="")
+
+    print_learnsets(tables, os.path.join(directory, "learnsets.txt"))
+    print_game_rules(tables, os.path.join(directory, "origins.txt"))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,3149 @@
+/* Generated by data/generate.py from the data/ tables; do not edit */
+
+#include "pokegen.h"
+
+static const char *const species_names[] = {
+  "Bulbasaur", "Ivysaur", "Venusaur", "Charmander",
+  "Charmeleon", "Charizard", "Squirtle", "Wartortle",
+  "Blastoise", "Caterpie", "Metapod", "Butterfree",
+  "Weedle", "Kakuna", "Beedrill", "Pidgey",
+  "Pidgeotto", "Pidgeot", "Rattata", "Raticate",
+  "Spearow", "Fearow", "Ekans", "Arbok",
+  "Pikachu", "Raichu", "Sandshrew", "Sandslash",
+  "Nidoran♀", "Nidorina", "Nidoqueen", "Nidoran♂",
+  "Nidorino", "Nidoking", "Clefairy", "Clefable",
+  "Vulpix", "Ninetales", "Jigglypuff", "Wigglytuff",
+  "Zubat", "Golbat", "Oddish", "Gloom",
+  "Vileplume", "Paras", "Parasect", "Venonat",
+  "Venomoth", "Diglett", "Dugtrio", "Meowth",
+  "Persian", "Psyduck", "Golduck", "Mankey",
+  "Primeape", "Growlithe", "Arcanine", "Poliwag",
+  "Poliwhirl", "Poliwrath", "Abra", "Kadabra",
+  "Alakazam", "Machop", "Machoke", "Machamp",
+  "Bellsprout", "Weepinbell", "Victreebel", "Tentacool",
+  "Tentacruel", "Geodude", "Graveler", "Golem",
+  "Ponyta", "Rapidash", "Slowpoke", "Slowbro",
+  "Magnemite", "Magneton", "Farfetch'd", "Doduo",
+  "Dodrio", "Seel", "Dewgong", "Grimer",
+  "Muk", "Shellder", "Cloyster", "Gastly",
+  "Haunter", "Gengar", "Onix", "Drowzee",
+  "Hypno", "Krabby", "Kingler", "Voltorb",
+  "Electrode", "Exeggcute", "Exeggutor", "Cubone",
+  "Marowak", "Hitmonlee", "Hitmonchan", "Lickitung",
+  "Koffing", "Weezing", "Rhyhorn", "Rhydon",
+  "Chansey", "Tangela", "Kangaskhan", "Horsea",
+  "Seadra", "Goldeen", "Seaking", "Staryu",
+  "Starmie", "Mr. Mime", "Scyther", "Jynx",
+  "Electabuzz", "Magmar", "Pinsir", "Tauros",
+  "Magikarp", "Gyarados", "Lapras", "Ditto",
+  "Eevee", "Vaporeon", "Jolteon", "Flareon",
+  "Porygon", "Omanyte", "Omastar", "Kabuto",
+  "Kabutops", "Aerodactyl", "Snorlax", "Articuno",
+  "Zapdos", "Moltres", "Dratini", "Dragonair",
+  "Dragonite", "Mewtwo", "Mew", "Chikorita",
+  "Bayleef", "Meganium", "Cyndaquil", "Quilava",
+  "Typhlosion", "Totodile", "Croconaw", "Feraligatr",
+  "Sentret", "Furret", "Hoothoot", "Noctowl",
+  "Ledyba", "Ledian", "Spinarak", "Ariados",
+  "Crobat", "Chinchou", "Lanturn", "Pichu",
+  "Cleffa", "Igglybuff", "Togepi", "Togetic",
+  "Natu", "Xatu", "Mareep", "Flaaffy",
+  "Ampharos", "Bellossom", "Marill", "Azumarill",
+  "Sudowoodo", "Politoed", "Hoppip", "Skiploom",
+  "Jumpluff", "Aipom", "Sunkern", "Sunflora",
+  "Yanma", "Wooper", "Quagsire", "Espeon",
+  "Umbreon", "Murkrow", "Slowking", "Misdreavus",
+  "Unown", "Wobbuffet", "Girafarig", "Pineco",
+  "Forretress", "Dunsparce", "Gligar", "Steelix",
+  "Snubbull", "Granbull", "Qwilfish", "Scizor",
+  "Shuckle", "Heracross", "Sneasel", "Teddiursa",
+  "Ursaring", "Slugma", "Magcargo", "Swinub",
+  "Piloswine", "Corsola", "Remoraid", "Octillery",
+  "Delibird", "Mantine", "Skarmory", "Houndour",
+  "Houndoom", "Kingdra", "Phanpy", "Donphan",
+  "Porygon2", "Stantler", "Smeargle", "Tyrogue",
+  "Hitmontop", "Smoochum", "Elekid", "Magby",
+  "Miltank", "Blissey", "Raikou", "Entei",
+  "Suicune", "Larvitar", "Pupitar", "Tyranitar",
+  "Lugia", "Ho-Oh", "Celebi", "Treecko",
+  "Grovyle", "Sceptile", "Torchic", "Combusken",
+  "Blaziken", "Mudkip", "Marshtomp", "Swampert",
+  "Poochyena", "Mightyena", "Zigzagoon", "Linoone",
+  "Wurmple", "Silcoon", "Beautifly", "Cascoon",
+  "Dustox", "Lotad", "Lombre", "Ludicolo",
+  "Seedot", "Nuzleaf", "Shiftry", "Nincada",
+  "Ninjask", "Shedinja", "Taillow", "Swellow",
+  "Shroomish", "Breloom", "Spinda", "Wingull",
+  "Pelipper", "Surskit", "Masquerain", "Wailmer",
+  "Wailord", "Skitty", "Delcatty", "Kecleon",
+  "Baltoy", "Claydol", "Nosepass", "Torkoal",
+  "Sableye", "Barboach", "Whiscash", "Luvdisc",
+  "Corphish", "Crawdaunt", "Feebas", "Milotic",
+  "Carvanha", "Sharpedo", "Trapinch", "Vibrava",
+  "Flygon", "Makuhita", "Hariyama", "Electrike",
+  "Manectric", "Numel", "Camerupt", "Spheal",
+  "Sealeo", "Walrein", "Cacnea", "Cacturne",
+  "Snorunt", "Glalie", "Lunatone", "Solrock",
+  "Azurill", "Spoink", "Grumpig", "Plusle",
+  "Minun", "Mawile", "Meditite", "Medicham",
+  "Swablu", "Altaria", "Wynaut", "Duskull",
+  "Dusclops", "Roselia", "Slakoth", "Vigoroth",
+  "Slaking", "Gulpin", "Swalot", "Tropius",
+  "Whismur", "Loudred", "Exploud", "Clamperl",
+  "Huntail", "Gorebyss", "Absol", "Shuppet",
+  "Banette", "Seviper", "Zangoose", "Relicanth",
+  "Aron", "Lairon", "Aggron", "Castform",
+  "Volbeat", "Illumise", "Lileep", "Cradily",
+  "Anorith", "Armaldo", "Ralts", "Kirlia",
+  "Gardevoir", "Bagon", "Shelgon", "Salamence",
+  "Beldum", "Metang", "Metagross", "Regirock",
+  "Regice", "Registeel", "Kyogre", "Groudon",
+  "Rayquaza", "Latias", "Latios", "Jirachi",
+  "Deoxys", "Chimecho", "Egg",
+};
+static const char *const species_keys[] = {
+  "bulbasaur", "ivysaur", "venusaur", "charmander", "charmeleon", "charizard",
+  "squirtle", "wartortle", "blastoise", "caterpie", "metapod", "butterfree",
+  "weedle", "kakuna", "beedrill", "pidgey", "pidgeotto", "pidgeot",
+  "rattata", "raticate", "spearow", "fearow", "ekans", "arbok",
+  "pikachu", "raichu", "sandshrew", "sandslash", "nidoranf", "nidorina",
+  "nidoqueen", "nidoranm", "nidorino", "nidoking", "clefairy", "clefable",
+  "vulpix", "ninetales", "jigglypuff", "wigglytuff", "zubat", "golbat",
+  "oddish", "gloom", "vileplume", "paras", "parasect", "venonat",
+  "venomoth", "diglett", "dugtrio", "meowth", "persian", "psyduck",
+  "golduck", "mankey", "primeape", "growlithe", "arcanine", "poliwag",
+  "poliwhirl", "poliwrath", "abra", "kadabra", "alakazam", "machop",
+  "machoke", "machamp", "bellsprout", "weepinbell", "victreebel", "tentacool",
+  "tentacruel", "geodude", "graveler", "golem", "ponyta", "rapidash",
+  "slowpoke", "slowbro", "magnemite", "magneton", "farfetchd", "doduo",
+  "dodrio", "seel", "dewgong", "grimer", "muk", "shellder",
+  "cloyster", "gastly", "haunter", "gengar", "onix", "drowzee",
+  "hypno", "krabby", "kingler", "voltorb", "electrode", "exeggcute",
+  "exeggutor", "cubone", "marowak", "hitmonlee", "hitmonchan", "lickitung",
+  "koffing", "weezing", "rhyhorn", "rhydon", "chansey", "tangela",
+  "kangaskhan", "horsea", "seadra", "goldeen", "seaking", "staryu",
+  "starmie", "mrmime", "scyther", "jynx", "electabuzz", "magmar",
+  "pinsir", "tauros", "magikarp", "gyarados", "lapras", "ditto",
+  "eevee", "vaporeon", "jolteon", "flareon", "porygon", "omanyte",
+  "omastar", "kabuto", "kabutops", "aerodactyl", "snorlax", "articuno",
+  "zapdos", "moltres", "dratini", "dragonair", "dragonite", "mewtwo",
+  "mew", "chikorita", "bayleef", "meganium", "cyndaquil", "quilava",
+  "typhlosion", "totodile", "croconaw", "feraligatr", "sentret", "furret",
+  "hoothoot", "noctowl", "ledyba", "ledian", "spinarak", "ariados",
+  "crobat", "chinchou", "lanturn", "pichu", "cleffa", "igglybuff",
+  "togepi", "togetic", "natu", "xatu", "mareep", "flaaffy",
+  "ampharos", "bellossom", "marill", "azumarill", "sudowoodo", "politoed",
+  "hoppip", "skiploom", "jumpluff", "aipom", "sunkern", "sunflora",
+  "yanma", "wooper", "quagsire", "espeon", "umbreon", "murkrow",
+  "slowking", "misdreavus", "unown", "wobbuffet", "girafarig", "pineco",
+  "forretress", "dunsparce", "gligar", "steelix", "snubbull", "granbull",
+  "qwilfish", "scizor", "shuckle", "heracross", "sneasel", "teddiursa",
+  "ursaring", "slugma", "magcargo", "swinub", "piloswine", "corsola",
+  "remoraid", "octillery", "delibird", "mantine", "skarmory", "houndour",
+  "houndoom", "kingdra", "phanpy", "donphan", "porygon2", "stantler",
+  "smeargle", "tyrogue", "hitmontop", "smoochum", "elekid", "magby",
+  "miltank", "blissey", "raikou", "entei", "suicune", "larvitar",
+  "pupitar", "tyranitar", "lugia", "hooh", "celebi", "treecko",
+  "grovyle", "sceptile", "torchic", "combusken", "blaziken", "mudkip",
+  "marshtomp", "swampert", "poochyena", "mightyena", "zigzagoon", "linoone",
+  "wurmple", "silcoon", "beautifly", "cascoon", "dustox", "lotad",
+  "lombre", "ludicolo", "seedot", "nuzleaf", "shiftry", "nincada",
+  "ninjask", "shedinja", "taillow", "swellow", "shroomish", "breloom",
+  "spinda", "wingull", "pelipper", "surskit", "masquerain", "wailmer",
+  "wailord", "skitty", "delcatty", "kecleon", "baltoy", "claydol",
+  "nosepass", "torkoal", "sableye", "barboach", "whiscash", "luvdisc",
+  "corphish", "crawdaunt", "feebas", "milotic", "carvanha", "sharpedo",
+  "trapinch", "vibrava", "flygon", "makuhita", "hariyama", "electrike",
+  "manectric", "numel", "camerupt", "spheal", "sealeo", "walrein",
+  "cacnea", "cacturne", "snorunt", "glalie", "lunatone", "solrock",
+  "azurill", "spoink", "grumpig", "plusle", "minun", "mawile",
+  "meditite", "medicham", "swablu", "altaria", "wynaut", "duskull",
+  "dusclops", "roselia", "slakoth", "vigoroth", "slaking", "gulpin",
+  "swalot", "tropius", "whismur", "loudred", "exploud", "clamperl",
+  "huntail", "gorebyss", "absol", "shuppet", "banette", "seviper",
+  "zangoose", "relicanth", "aron", "lairon", "aggron", "castform",
+  "volbeat", "illumise", "lileep", "cradily", "anorith", "armaldo",
+  "ralts", "kirlia", "gardevoir", "bagon", "shelgon", "salamence",
+  "beldum", "metang", "metagross", "regirock", "regice", "registeel",
+  "kyogre", "groudon", "rayquaza", "latias", "latios", "jirachi",
+  "deoxys", "chimecho", "egg",
+};
+static const uint16_t species_values[] = {
+  0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa,
+  0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13, 0x14,
+  0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e,
+  0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c,
+  0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+  0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+  0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64,
+  0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
+  0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+  0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82,
+  0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c,
+  0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+  0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0,
+  0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+  0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4,
+  0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe,
+  0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
+  0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1, 0xd2,
+  0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc,
+  0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+  0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, 0xf0,
+  0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa,
+  0xfb, 0x115, 0x116, 0x117, 0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d,
+  0x11e, 0x11f, 0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+  0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f, 0x130, 0x131,
+  0x132, 0x133, 0x134, 0x135, 0x136, 0x137, 0x138, 0x139, 0x13a, 0x13b,
+  0x13c, 0x13d, 0x13e, 0x13f, 0x140, 0x141, 0x142, 0x143, 0x144, 0x145,
+  0x146, 0x147, 0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+  0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157, 0x158, 0x159,
+  0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f, 0x160, 0x161, 0x162, 0x163,
+  0x164, 0x165, 0x166, 0x167, 0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d,
+  0x16e, 0x16f, 0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+  0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f, 0x180, 0x181,
+  0x182, 0x183, 0x184, 0x185, 0x186, 0x187, 0x188, 0x189, 0x18a, 0x18b,
+  0x18c, 0x18d, 0x18e, 0x18f, 0x190, 0x191, 0x192, 0x193, 0x194, 0x195,
+  0x196, 0x197, 0x198, 0x199, 0x19a, 0x19b, 0x19c,
+};
+static const uint16_t species_seeds[] = {
+  3, 3, 5, 3, 3, 1, 3, 8, 10, 2, 9, 1,
+  8, 3, 4, 4, 1, 9, 4, 0, 7, 7, 5, 1,
+  1, 1, 2, 3, 3, 3, 16, 2, 22, 3, 2, 5,
+  1, 5, 2, 8, 8, 6, 1, 1, 2, 2, 1, 1,
+  24, 1, 2, 8, 3, 1, 5, 2, 3, 0, 13, 21,
+  1, 12, 2, 1, 7, 2, 1, 2, 4, 3, 9, 1,
+  12, 1, 20, 3, 7, 3, 6, 23, 2, 2, 11, 3,
+  6, 11, 1, 7, 1, 5, 1, 11, 2, 1, 12, 1,
+  11, 2, 1, 16, 3, 3, 24, 2, 8, 6, 18, 1,
+  5, 2, 3, 16, 2, 9, 8, 20, 19, 1, 18, 4,
+  14, 33, 16, 0, 7, 1, 6, 12, 26,
+};
+static const uint16_t species_slots[] = {
+  208, 226, 238, 134, 137, 316, 235, 0, 21, 138, 0, 0, 223, 297, 0, 251,
+  0, 0, 0, 378, 140, 0, 186, 169, 0, 93, 0, 0, 272, 111, 269, 105,
+  0, 192, 239, 85, 123, 92, 0, 319, 116, 44, 275, 289, 340, 181, 98, 132,
+  5, 229, 32, 39, 262, 174, 122, 363, 232, 64, 153, 271, 347, 0, 0, 130,
+  168, 0, 283, 101, 233, 203, 67, 40, 207, 323, 30, 0, 0, 261, 250, 87,
+  31, 0, 333, 260, 320, 0, 0, 348, 343, 115, 0, 0, 0, 15, 266, 0,
+  59, 270, 248, 195, 151, 302, 0, 274, 158, 265, 330, 351, 180, 189, 321, 78,
+  193, 311, 277, 325, 54, 361, 317, 199, 213, 210, 74, 155, 0, 89, 352, 164,
+  338, 0, 290, 282, 166, 0, 0, 0, 0, 107, 63, 58, 0, 0, 37, 331,
+  380, 0, 0, 22, 10, 327, 0, 358, 374, 0, 90, 300, 13, 0, 51, 147,
+  0, 0, 178, 381, 128, 0, 38, 0, 68, 0, 204, 217, 48, 117, 237, 0,
+  7, 0, 0, 0, 0, 184, 143, 296, 103, 179, 0, 4, 154, 71, 46, 0,
+  0, 230, 0, 252, 228, 205, 14, 182, 334, 108, 342, 273, 0, 60, 387, 200,
+  191, 125, 1, 0, 209, 0, 306, 243, 194, 126, 176, 124, 65, 0, 253, 0,
+  308, 305, 36, 187, 45, 0, 0, 371, 336, 364, 139, 53, 227, 0, 281, 318,
+  9, 66, 173, 291, 95, 249, 183, 113, 206, 0, 326, 0, 167, 328, 383, 94,
+  267, 0, 0, 198, 8, 0, 299, 112, 83, 0, 0, 0, 61, 365, 0, 0,
+  2, 142, 384, 84, 0, 91, 216, 27, 219, 278, 295, 329, 212, 339, 280, 385,
+  190, 24, 0, 106, 50, 214, 0, 185, 202, 70, 285, 141, 307, 41, 12, 170,
+  0, 335, 0, 0, 247, 310, 102, 19, 0, 96, 259, 149, 240, 344, 379, 373,
+  75, 0, 0, 148, 52, 332, 292, 314, 0, 372, 0, 25, 315, 0, 28, 0,
+  298, 17, 258, 0, 0, 0, 244, 255, 157, 35, 221, 156, 0, 129, 0, 276,
+  88, 175, 49, 0, 301, 362, 215, 57, 152, 81, 225, 268, 62, 246, 357, 211,
+  109, 0, 3, 201, 136, 356, 350, 218, 0, 322, 47, 367, 359, 0, 0, 0,
+  77, 0, 146, 355, 376, 254, 171, 69, 377, 72, 0, 0, 0, 312, 0, 177,
+  284, 11, 0, 160, 231, 309, 0, 370, 245, 337, 23, 0, 119, 16, 256, 0,
+  234, 33, 349, 110, 0, 0, 127, 288, 163, 99, 303, 236, 341, 360, 196, 6,
+  368, 145, 161, 0, 97, 82, 0, 120, 165, 0, 313, 346, 159, 287, 242, 0,
+  42, 0, 26, 0, 144, 386, 0, 382, 150, 279, 0, 220, 257, 293, 121, 0,
+  0, 0, 131, 353, 345, 264, 162, 135, 0, 76, 241, 20, 100, 222, 0, 73,
+  369, 34, 354, 0, 0, 224, 29, 0, 197, 172, 79, 0, 366, 118, 294, 56,
+  324, 304, 0, 263, 188, 43, 55, 18, 80, 86, 375, 133, 0, 114, 104, 286,
+};
+const struct NameTable species_table = {
+  species_names, species_keys, species_values, 387,
+  species_seeds, 129, species_slots, 512
+};
+
+static const char *const items_names[] = {
+  "None", "Master Ball", "Ultra Ball", "Great Ball",
+  "Poké Ball", "Safari Ball", "Net Ball", "Dive Ball",
+  "Nest Ball", "Repeat Ball", "Timer Ball", "Luxury Ball",
+  "Premier Ball", "Potion", "Antidote", "Burn Heal",
+  "Ice Heal", "Awakening", "Parlyz Heal", "Full Restore",
+  "Max Potion", "Hyper Potion", "Super Potion", "Full Heal",
+  "Revive", "Max Revive", "Fresh Water", "Soda Pop",
+  "Lemonade", "Moomoo Milk", "EnergyPowder", "Energy Root",
+  "Heal Powder", "Revival Herb", "Ether", "Max Ether",
+  "Elixir", "Max Elixir", "Lava Cookie", "Blue Flute",
+  "Yellow Flute", "Red Flute", "Black Flute", "White Flute",
+  "Berry Juice", "Sacred Ash", "Shoal Salt", "Shoal Shell",
+  "Red Shard", "Blue Shard", "Yellow Shard", "Green Shard",
+  "HP Up", "Protein", "Iron", "Carbos",
+  "Calcium", "Rare Candy", "PP Up", "Zinc",
+  "PP Max", "Guard Spec.", "Dire Hit", "X Attack",
+  "X Defend", "X Speed", "X Accuracy", "X Special",
+  "Poké Doll", "Fluffy Tail", "Super Repel", "Max Repel",
+  "Escape Rope", "Repel", "Sun Stone", "Moon Stone",
+  "Fire Stone", "Thunderstone", "Water Stone", "Leaf Stone",
+  "TinyMushroom", "Big Mushroom", "Pearl", "Big Pearl",
+  "Stardust", "Star Piece", "Nugget", "Heart Scale",
+  "Orange Mail", "Harbor Mail", "Glitter Mail", "Mech Mail",
+  "Wood Mail", "Wave Mail", "Bead Mail", "Shadow Mail",
+  "Tropic Mail", "Dream Mail", "Fab Mail", "Retro Mail",
+  "Cheri Berry", "Chesto Berry", "Pecha Berry", "Rawst Berry",
+  "Aspear Berry", "Leppa Berry", "Oran Berry", "Persim Berry",
+  "Lum Berry", "Sitrus Berry", "Figy Berry", "Wiki Berry",
+  "Mago Berry", "Aguav Berry", "Iapapa Berry", "Razz Berry",
+  "Bluk Berry", "Nanab Berry", "Wepear Berry", "Pinap Berry",
+  "Pomeg Berry", "Kelpsy Berry", "Qualot Berry", "Hondew Berry",
+  "Grepa Berry", "Tamato Berry", "Cornn Berry", "Magost Berry",
+  "Rabuta Berry", "Nomel Berry", "Spelon Berry", "Pamtre Berry",
+  "Watmel Berry", "Durin Berry", "Belue Berry", "Liechi Berry",
+  "Ganlon Berry", "Salac Berry", "Petaya Berry", "Apicot Berry",
+  "Lansat Berry", "Starf Berry", "Enigma Berry", "BrightPowder",
+  "White Herb", "Macho Brace", "Exp. Share", "Quick Claw",
+  "Soothe Bell", "Mental Herb", "Choice Band", "King's Rock",
+  "SilverPowder", "Amulet Coin", "Cleanse Tag", "Soul Dew",
+  "DeepSeaTooth", "DeepSeaScale", "Smoke Ball", "Everstone",
+  "Focus Band", "Lucky Egg", "Scope Lens", "Metal Coat",
+  "Leftovers", "Dragon Scale", "Light Ball", "Soft Sand",
+  "Hard Stone", "Miracle Seed", "BlackGlasses", "Black Belt",
+  "Magnet", "Mystic Water", "Sharp Beak", "Poison Barb",
+  "NeverMeltIce", "Spell Tag", "TwistedSpoon", "Charcoal",
+  "Dragon Fang", "Silk Scarf", "Up-Grade", "Shell Bell",
+  "Sea Incense", "Lax Incense", "Lucky Punch", "Metal Powder",
+  "Thick Club", "Stick", "Red Scarf", "Blue Scarf",
+  "Pink Scarf", "Green Scarf", "Yellow Scarf", "Mach Bike",
+  "Coin Case", "Itemfinder", "Old Rod", "Good Rod",
+  "Super Rod", "S.S. Ticket", "Contest Pass", "Wailmer Pail",
+  "Devon Goods", "Soot Sack", "Basement Key", "Acro Bike",
+  "Pokéblock Case", "Letter", "Eon Ticket", "Red Orb",
+  "Blue Orb", "Scanner", "Go-Goggles", "Meteorite",
+  "Rm. 1 Key", "Rm. 2 Key", "Rm. 4 Key", "Rm. 6 Key",
+  "Storage Key", "Root Fossil", "Claw Fossil", "Devon Scope",
+  "TM01", "TM02", "TM03", "TM04",
+  "TM05", "TM06", "TM07", "TM08",
+  "TM09", "TM10", "TM11", "TM12",
+  "TM13", "TM14", "TM15", "TM16",
+  "TM17", "TM18", "TM19", "TM20",
+  "TM21", "TM22", "TM23", "TM24",
+  "TM25", "TM26", "TM27", "TM28",
+  "TM29", "TM30", "TM31", "TM32",
+  "TM33", "TM34", "TM35", "TM36",
+  "TM37", "TM38", "TM39", "TM40",
+  "TM41", "TM42", "TM43", "TM44",
+  "TM45", "TM46", "TM47", "TM48",
+  "TM49", "TM50", "HM01", "HM02",
+  "HM03", "HM04", "HM05", "HM06",
+  "HM07", "HM08", "Oak's Parcel", "Poké Flute",
+  "Secret Key", "Bike Voucher", "Gold Teeth", "Old Amber",
+  "Card Key", "Lift Key", "Helix Fossil", "Dome Fossil",
+  "Silph Scope", "Bicycle", "Town Map", "VS Seeker",
+  "Fame Checker", "TM Case", "Berry Pouch", "Teachy TV",
+  "Tri-Pass", "Rainbow Pass", "Tea", "MysticTicket",
+  "AuroraTicket", "Powder Jar", "Ruby", "Sapphire",
+  "Magma Emblem", "Old Sea Map",
+};
+static const char *const items_keys[] = {
+  "none", "masterball", "ultraball", "greatball", "pokeball", "safariball",
+  "netball", "diveball", "nestball", "repeatball", "timerball", "luxuryball",
+  "premierball", "potion", "antidote", "burnheal", "iceheal", "awakening",
+  "parlyzheal", "fullrestore", "maxpotion", "hyperpotion", "superpotion", "fullheal",
+  "revive", "maxrevive", "freshwater", "sodapop", "lemonade", "moomoomilk",
+  "energypowder", "energyroot", "healpowder", "revivalherb", "ether", "maxether",
+  "elixir", "maxelixir", "lavacookie", "blueflute", "yellowflute", "redflute",
+  "blackflute", "whiteflute", "berryjuice", "sacredash", "shoalsalt", "shoalshell",
+  "redshard", "blueshard", "yellowshard", "greenshard", "hpup", "protein",
+  "iron", "carbos", "calcium", "rarecandy", "ppup", "zinc",
+  "ppmax", "guardspec", "direhit", "xattack", "xdefend", "xspeed",
+  "xaccuracy", "xspecial", "pokedoll", "fluffytail", "superrepel", "maxrepel",
+  "escaperope", "repel", "sunstone", "moonstone", "firestone", "thunderstone",
+  "waterstone", "leafstone", "tinymushroom", "bigmushroom", "pearl", "bigpearl",
+  "stardust", "starpiece", "nugget", "heartscale", "orangemail", "harbormail",
+  "glittermail", "mechmail", "woodmail", "wavemail", "beadmail", "shadowmail",
+  "tropicmail", "dreammail", "fabmail", "retromail", "cheriberry", "chestoberry",
+  "pechaberry", "rawstberry", "aspearberry", "leppaberry", "oranberry", "persimberry",
+  "lumberry", "sitrusberry", "figyberry", "wikiberry", "magoberry", "aguavberry",
+  "iapapaberry", "razzberry", "blukberry", "nanabberry", "wepearberry", "pinapberry",
+  "pomegberry", "kelpsyberry", "qualotberry", "hondewberry", "grepaberry", "tamatoberry",
+  "cornnberry", "magostberry", "rabutaberry", "nomelberry", "spelonberry", "pamtreberry",
+  "watmelberry", "durinberry", "belueberry", "liechiberry", "ganlonberry", "salacberry",
+  "petayaberry", "apicotberry", "lansatberry", "starfberry", "enigmaberry", "brightpowder",
+  "whiteherb", "machobrace", "expshare", "quickclaw", "soothebell", "mentalherb",
+  "choiceband", "kingsrock", "silverpowder", "amuletcoin", "cleansetag", "souldew",
+  "deepseatooth", "deepseascale", "smokeball", "everstone", "focusband", "luckyegg",
+  "scopelens", "metalcoat", "leftovers", "dragonscale", "lightball", "softsand",
+  "hardstone", "miracleseed", "blackglasses", "blackbelt", "magnet", "mysticwater",
+  "sharpbeak", "poisonbarb", "nevermeltice", "spelltag", "twistedspoon", "charcoal",
+  "dragonfang", "silkscarf", "upgrade", "shellbell", "seaincense", "laxincense",
+  "luckypunch", "metalpowder", "thickclub", "stick", "redscarf", "bluescarf",
+  "pinkscarf", "greenscarf", "yellowscarf", "machbike", "coincase", "itemfinder",
+  "oldrod", "goodrod", "superrod", "ssticket", "contestpass", "wailmerpail",
+  "devongoods", "sootsack", "basementkey", "acrobike", "pokeblockcase", "letter",
+  "eonticket", "redorb", "blueorb", "scanner", "gogoggles", "meteorite",
+  "rm1key", "rm2key", "rm4key", "rm6key", "storagekey", "rootfossil",
+  "clawfossil", "devonscope", "tm01", "tm02", "tm03", "tm04",
+  "tm05", "tm06", "tm07", "tm08", "tm09", "tm10",
+  "tm11", "tm12", "tm13", "tm14", "tm15", "tm16",
+  "tm17", "tm18", "tm19", "tm20", "tm21", "tm22",
+  "tm23", "tm24", "tm25", "tm26", "tm27", "tm28",
+  "tm29", "tm30", "tm31", "tm32", "tm33", "tm34",
+  "tm35", "tm36", "tm37", "tm38", "tm39", "tm40",
+  "tm41", "tm42", "tm43", "tm44", "tm45", "tm46",
+  "tm47", "tm48", "tm49", "tm50", "hm01", "hm02",
+  "hm03", "hm04", "hm05", "hm06", "hm07", "hm08",
+  "oaksparcel", "pokeflute", "secretkey", "bikevoucher", "goldteeth", "oldamber",
+  "cardkey", "liftkey", "helixfossil", "domefossil", "silphscope", "bicycle",
+  "townmap", "vsseeker", "famechecker", "tmcase", "berrypouch", "teachytv",
+  "tripass", "rainbowpass", "tea", "mysticticket", "auroraticket", "powderjar",
+  "ruby", "sapphire", "magmaemblem", "oldseamap",
+};
+static const uint16_t items_values[] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9,
+  0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13,
+  0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+  0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+  0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31,
+  0x32, 0x33, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
+  0x53, 0x54, 0x55, 0x56, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62,
+  0x67, 0x68, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x79, 0x7a,
+  0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84,
+  0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e,
+  0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+  0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2,
+  0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac,
+  0xad, 0xae, 0xaf, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9,
+  0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3,
+  0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd,
+  0xce, 0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+  0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1,
+  0xfe, 0xff, 0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+  0x108, 0x109, 0x10a, 0x10c, 0x10d, 0x10e, 0x10f, 0x110, 0x111, 0x112,
+  0x113, 0x114, 0x115, 0x116, 0x117, 0x118, 0x119, 0x11a, 0x11b, 0x11c,
+  0x11d, 0x11e, 0x11f, 0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126,
+  0x127, 0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f, 0x130,
+  0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137, 0x138, 0x139, 0x13a,
+  0x13b, 0x13c, 0x13d, 0x13e, 0x13f, 0x140, 0x141, 0x142, 0x143, 0x144,
+  0x145, 0x146, 0x147, 0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e,
+  0x14f, 0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157, 0x158,
+  0x159, 0x15a, 0x15d, 0x15e, 0x15f, 0x160, 0x161, 0x162, 0x163, 0x164,
+  0x165, 0x166, 0x167, 0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e,
+  0x16f, 0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177, 0x178,
+};
+static const uint16_t items_seeds[] = {
+  18, 1, 2, 1, 1, 2, 2, 4, 0, 4, 1, 6,
+  1, 0, 1, 1, 6, 1, 1, 1, 5, 1, 0, 4,
+  1, 4, 1, 3, 4, 1, 1, 1, 3, 1, 1, 1,
+  1, 1, 5, 1, 2, 1, 3, 12, 3, 0, 8, 4,
+  2, 1, 7, 2, 2, 4, 1, 7, 5, 8, 4, 7,
+  1, 3, 5, 1, 9, 9, 3, 2, 2, 6, 1, 3,
+  10, 4, 5, 3, 1, 2, 2, 4, 14, 3, 1, 6,
+  3, 1, 10, 1, 1, 5, 1, 5, 4, 2, 1, 16,
+  2, 2, 4, 8, 0, 8, 6, 3,
+};
+static const uint16_t items_slots[] = {
+  0, 0, 35, 253, 0, 182, 216, 221, 26, 0, 0, 0, 0, 0, 0, 0,
+  10, 58, 0, 290, 0, 289, 0, 0, 223, 0, 303, 40, 148, 129, 0, 273,
+  0, 310, 124, 205, 187, 104, 208, 231, 160, 0, 190, 0, 185, 246, 2, 0,
+  0, 115, 142, 0, 219, 228, 33, 186, 0, 51, 299, 0, 0, 269, 241, 140,
+  42, 150, 0, 67, 295, 0, 0, 191, 101, 0, 0, 0, 0, 78, 164, 23,
+  125, 209, 79, 0, 0, 270, 0, 193, 81, 74, 307, 250, 85, 170, 45, 80,
+  198, 0, 133, 0, 0, 0, 28, 268, 215, 201, 229, 7, 252, 0, 97, 172,
+  19, 181, 202, 283, 236, 0, 82, 225, 0, 0, 0, 184, 230, 178, 203, 0,
+  24, 94, 0, 0, 195, 238, 0, 0, 137, 275, 218, 0, 27, 88, 47, 0,
+  38, 0, 0, 271, 114, 89, 247, 0, 73, 71, 0, 0, 0, 139, 0, 93,
+  0, 0, 0, 95, 112, 298, 0, 260, 0, 0, 0, 0, 0, 118, 297, 117,
+  292, 96, 141, 192, 149, 0, 0, 121, 0, 0, 0, 72, 0, 0, 62, 0,
+  179, 291, 8, 0, 0, 0, 55, 276, 154, 113, 0, 0, 306, 0, 262, 61,
+  146, 0, 0, 0, 86, 1, 0, 0, 153, 0, 0, 248, 165, 54, 123, 52,
+  284, 0, 0, 258, 0, 0, 0, 13, 0, 0, 0, 91, 287, 235, 48, 217,
+  265, 0, 102, 214, 0, 0, 0, 175, 75, 31, 0, 199, 127, 0, 0, 21,
+  0, 0, 76, 0, 294, 25, 213, 280, 0, 65, 0, 0, 242, 0, 0, 157,
+  0, 34, 77, 0, 232, 261, 163, 128, 0, 212, 240, 0, 167, 0, 296, 135,
+  84, 222, 119, 251, 0, 0, 39, 59, 0, 279, 56, 168, 282, 0, 0, 234,
+  0, 0, 30, 300, 255, 206, 266, 0, 0, 0, 174, 0, 278, 207, 176, 245,
+  106, 0, 32, 226, 64, 0, 0, 277, 243, 224, 0, 281, 256, 0, 0, 301,
+  126, 109, 233, 99, 0, 0, 11, 44, 0, 0, 3, 200, 272, 136, 188, 29,
+  0, 0, 166, 0, 155, 0, 0, 0, 211, 0, 0, 0, 134, 0, 57, 267,
+  0, 0, 46, 177, 158, 116, 0, 0, 161, 110, 0, 244, 66, 285, 0, 309,
+  50, 0, 0, 4, 162, 0, 151, 263, 0, 49, 0, 0, 194, 70, 227, 259,
+  103, 0, 0, 43, 41, 0, 120, 111, 144, 20, 152, 0, 0, 183, 0, 0,
+  0, 180, 90, 0, 107, 83, 0, 0, 189, 0, 0, 130, 147, 6, 0, 171,
+  0, 264, 9, 196, 0, 0, 257, 274, 204, 138, 0, 169, 12, 0, 87, 0,
+  0, 0, 0, 308, 173, 0, 0, 63, 14, 0, 156, 302, 305, 0, 0, 0,
+  16, 145, 197, 37, 239, 0, 60, 0, 249, 68, 92, 15, 131, 98, 105, 18,
+  69, 0, 53, 0, 0, 0, 100, 286, 237, 108, 254, 293, 0, 288, 22, 36,
+  0, 0, 132, 159, 17, 5, 0, 0, 220, 122, 210, 304, 0, 0, 0, 143,
+};
+const struct NameTable items_table = {
+  items_names, items_keys, items_values, 310,
+  items_seeds, 104, items_slots, 512
+};
+
+static const char *const moves_names[] = {
+  "None", "Pound", "Karate Chop", "DoubleSlap",
+  "Comet Punch", "Mega Punch", "Pay Day", "Fire Punch",
+  "Ice Punch", "ThunderPunch", "Scratch", "ViceGrip",
+  "Guillotine", "Razor Wind", "Swords Dance", "Cut",
+  "Gust", "Wing Attack", "Whirlwind", "Fly",
+  "Bind", "Slam", "Vine Whip", "Stomp",
+  "Double Kick", "Mega Kick", "Jump Kick", "Rolling Kick",
+  "Sand-Attack", "Headbutt", "Horn Attack", "Fury Attack",
+  "Horn Drill", "Tackle", "Body Slam", "Wrap",
+  "Take Down", "Thrash", "Double-Edge", "Tail Whip",
+  "Poison Sting", "Twineedle", "Pin Missile", "Leer",
+  "Bite", "Growl", "Roar", "Sing",
+  "Supersonic", "SonicBoom", "Disable", "Acid",
+  "Ember", "Flamethrower", "Mist", "Water Gun",
+  "Hydro Pump", "Surf", "Ice Beam", "Blizzard",
+  "Psybeam", "BubbleBeam", "Aurora Beam", "Hyper Beam",
+  "Peck", "Drill Peck", "Submission", "Low Kick",
+  "Counter", "Seismic Toss", "Strength", "Absorb",
+  "Mega Drain", "Leech Seed", "Growth", "Razor Leaf",
+  "SolarBeam", "PoisonPowder", "Stun Spore", "Sleep Powder",
+  "Petal Dance", "String Shot", "Dragon Rage", "Fire Spin",
+  "ThunderShock", "Thunderbolt", "Thunder Wave", "Thunder",
+  "Rock Throw", "Earthquake", "Fissure", "Dig",
+  "Toxic", "Confusion", "Psychic", "Hypnosis",
+  "Meditate", "Agility", "Quick Attack", "Rage",
+  "Teleport", "Night Shade", "Mimic", "Screech",
+  "Double Team", "Recover", "Harden", "Minimize",
+  "SmokeScreen", "Confuse Ray", "Withdraw", "Defense Curl",
+  "Barrier", "Light Screen", "Haze", "Reflect",
+  "Focus Energy", "Bide", "Metronome", "Mirror Move",
+  "Selfdestruct", "Egg Bomb", "Lick", "Smog",
+  "Sludge", "Bone Club", "Fire Blast", "Waterfall",
+  "Clamp", "Swift", "Skull Bash", "Spike Cannon",
+  "Constrict", "Amnesia", "Kinesis", "Softboiled",
+  "Hi Jump Kick", "Glare", "Dream Eater", "Poison Gas",
+  "Barrage", "Leech Life", "Lovely Kiss", "Sky Attack",
+  "Transform", "Bubble", "Dizzy Punch", "Spore",
+  "Flash", "Psywave", "Splash", "Acid Armor",
+  "Crabhammer", "Explosion", "Fury Swipes", "Bonemerang",
+  "Rest", "Rock Slide", "Hyper Fang", "Sharpen",
+  "Conversion", "Tri Attack", "Super Fang", "Slash",
+  "Substitute", "Struggle", "Sketch", "Triple Kick",
+  "Thief", "Spider Web", "Mind Reader", "Nightmare",
+  "Flame Wheel", "Snore", "Curse", "Flail",
+  "Conversion 2", "Aeroblast", "Cotton Spore", "Reversal",
+  "Spite", "Powder Snow", "Protect", "Mach Punch",
+  "Scary Face", "Faint Attack", "Sweet Kiss", "Belly Drum",
+  "Sludge Bomb", "Mud-Slap", "Octazooka", "Spikes",
+  "Zap Cannon", "Foresight", "Destiny Bond", "Perish Song",
+  "Icy Wind", "Detect", "Bone Rush", "Lock-On",
+  "Outrage", "Sandstorm", "Giga Drain", "Endure",
+  "Charm", "Rollout", "False Swipe", "Swagger",
+  "Milk Drink", "Spark", "Fury Cutter", "Steel Wing",
+  "Mean Look", "Attract", "Sleep Talk", "Heal Bell",
+  "Return", "Present", "Frustration", "Safeguard",
+  "Pain Split", "Sacred Fire", "Magnitude", "DynamicPunch",
+  "Megahorn", "DragonBreath", "Baton Pass", "Encore",
+  "Pursuit", "Rapid Spin", "Sweet Scent", "Iron Tail",
+  "Metal Claw", "Vital Throw", "Morning Sun", "Synthesis",
+  "Moonlight", "Hidden Power", "Cross Chop", "Twister",
+  "Rain Dance", "Sunny Day", "Crunch", "Mirror Coat",
+  "Psych Up", "ExtremeSpeed", "AncientPower", "Shadow Ball",
+  "Future Sight", "Rock Smash", "Whirlpool", "Beat Up",
+  "Fake Out", "Uproar", "Stockpile", "Spit Up",
+  "Swallow", "Heat Wave", "Hail", "Torment",
+  "Flatter", "Will-O-Wisp", "Memento", "Facade",
+  "Focus Punch", "SmellingSalt", "Follow Me", "Nature Power",
+  "Charge", "Taunt", "Helping Hand", "Trick",
+  "Role Play", "Wish", "Assist", "Ingrain",
+  "Superpower", "Magic Coat", "Recycle", "Revenge",
+  "Brick Break", "Yawn", "Knock Off", "Endeavor",
+  "Eruption", "Skill Swap", "Imprison", "Refresh",
+  "Grudge", "Snatch", "Secret Power", "Dive",
+  "Arm Thrust", "Camouflage", "Tail Glow", "Luster Purge",
+  "Mist Ball", "FeatherDance", "Teeter Dance", "Blaze Kick",
+  "Mud Sport", "Ice Ball", "Needle Arm", "Slack Off",
+  "Hyper Voice", "Poison Fang", "Crush Claw", "Blast Burn",
+  "Hydro Cannon", "Meteor Mash", "Astonish", "Weather Ball",
+  "Aromatherapy", "Fake Tears", "Air Cutter", "Overheat",
+  "Odor Sleuth", "Rock Tomb", "Silver Wind", "Metal Sound",
+  "GrassWhistle", "Tickle", "Cosmic Power", "Water Spout",
+  "Signal Beam", "Shadow Punch", "Extrasensory", "Sky Uppercut",
+  "Sand Tomb", "Sheer Cold", "Muddy Water", "Bullet Seed",
+  "Aerial Ace", "Icicle Spear", "Iron Defense", "Block",
+  "Howl", "Dragon Claw", "Frenzy Plant", "Bulk Up",
+  "Bounce", "Mud Shot", "Poison Tail", "Covet",
+  "Volt Tackle", "Magical Leaf", "Water Sport", "Calm Mind",
+  "Leaf Blade", "Dragon Dance", "Rock Blast", "Shock Wave",
+  "Water Pulse", "Doom Desire", "Psycho Boost",
+};
+static const char *const moves_keys[] = {
+  "none", "pound", "karatechop", "doubleslap", "cometpunch", "megapunch",
+  "payday", "firepunch", "icepunch", "thunderpunch", "scratch", "vicegrip",
+  "guillotine", "razorwind", "swordsdance", "cut", "gust", "wingattack",
+  "whirlwind", "fly", "bind", "slam", "vinewhip", "stomp",
+  "doublekick", "megakick", "jumpkick", "rollingkick", "sandattack", "headbutt",
+  "hornattack", "furyattack", "horndrill", "tackle", "bodyslam", "wrap",
+  "takedown", "thrash", "doubleedge", "tailwhip", "poisonsting", "twineedle",
+  "pinmissile", "leer", "bite", "growl", "roar", "sing",
+  "supersonic", "sonicboom", "disable", "acid", "ember", "flamethrower",
+  "mist", "watergun", "hydropump", "surf", "icebeam", "blizzard",
+  "psybeam", "bubblebeam", "aurorabeam", "hyperbeam", "peck", "drillpeck",
+  "submission", "lowkick", "counter", "seismictoss", "strength", "absorb",
+  "megadrain", "leechseed", "growth", "razorleaf", "solarbeam", "poisonpowder",
+  "stunspore", "sleeppowder", "petaldance", "stringshot", "dragonrage", "firespin",
+  "thundershock", "thunderbolt", "thunderwave", "thunder", "rockthrow", "earthquake",
+  "fissure", "dig", "toxic", "confusion", "psychic", "hypnosis",
+  "meditate", "agility", "quickattack", "rage", "teleport", "nightshade",
+  "mimic", "screech", "doubleteam", "recover", "harden", "minimize",
+  "smokescreen", "confuseray", "withdraw", "defensecurl", "barrier", "lightscreen",
+  "haze", "reflect", "focusenergy", "bide", "metronome", "mirrormove",
+  "selfdestruct", "eggbomb", "lick", "smog", "sludge", "boneclub",
+  "fireblast", "waterfall", "clamp", "swift", "skullbash", "spikecannon",
+  "constrict", "amnesia", "kinesis", "softboiled", "hijumpkick", "glare",
+  "dreameater", "poisongas", "barrage", "leechlife", "lovelykiss", "skyattack",
+  "transform", "bubble", "dizzypunch", "spore", "flash", "psywave",
+  "splash", "acidarmor", "crabhammer", "explosion", "furyswipes", "bonemerang",
+  "rest", "rockslide", "hyperfang", "sharpen", "conversion", "triattack",
+  "superfang", "slash", "substitute", "struggle", "sketch", "triplekick",
+  "thief", "spiderweb", "mindreader", "nightmare", "flamewheel", "snore",
+  "curse", "flail", "conversion2", "aeroblast", "cottonspore", "reversal",
+  "spite", "powdersnow", "protect", "machpunch", "scaryface", "faintattack",
+  "sweetkiss", "bellydrum", "sludgebomb", "mudslap", "octazooka", "spikes",
+  "zapcannon", "foresight", "destinybond", "perishsong", "icywind", "detect",
+  "bonerush", "lockon", "outrage", "sandstorm", "gigadrain", "endure",
+  "charm", "rollout", "falseswipe", "swagger", "milkdrink", "spark",
+  "furycutter", "steelwing", "meanlook", "attract", "sleeptalk", "healbell",
+  "return", "present", "frustration", "safeguard", "painsplit", "sacredfire",
+  "magnitude", "dynamicpunch", "megahorn", "dragonbreath", "batonpass", "encore",
+  "pursuit", "rapidspin", "sweetscent", "irontail", "metalclaw", "vitalthrow",
+  "morningsun", "synthesis", "moonlight", "hiddenpower", "crosschop", "twister",
+  "raindance", "sunnyday", "crunch", "mirrorcoat", "psychup", "extremespeed",
+  "ancientpower", "shadowball", "futuresight", "rocksmash", "whirlpool", "beatup",
+  "fakeout", "uproar", "stockpile", "spitup", "swallow", "heatwave",
+  "hail", "torment", "flatter", "willowisp", "memento", "facade",
+  "focuspunch", "smellingsalt", "followme", "naturepower", "charge", "taunt",
+  "helpinghand", "trick", "roleplay", "wish", "assist", "ingrain",
+  "superpower", "magiccoat", "recycle", "revenge", "brickbreak", "yawn",
+  "knockoff", "endeavor", "eruption", "skillswap", "imprison", "refresh",
+  "grudge", "snatch", "secretpower", "dive", "armthrust", "camouflage",
+  "tailglow", "lusterpurge", "mistball", "featherdance", "teeterdance", "blazekick",
+  "mudsport", "iceball", "needlearm", "slackoff", "hypervoice", "poisonfang",
+  "crushclaw", "blastburn", "hydrocannon", "meteormash", "astonish", "weatherball",
+  "aromatherapy", "faketears", "aircutter", "overheat", "odorsleuth", "rocktomb",
+  "silverwind", "metalsound", "grasswhistle", "tickle", "cosmicpower", "waterspout",
+  "signalbeam", "shadowpunch", "extrasensory", "skyuppercut", "sandtomb", "sheercold",
+  "muddywater", "bulletseed", "aerialace", "iciclespear", "irondefense", "block",
+  "howl", "dragonclaw", "frenzyplant", "bulkup", "bounce", "mudshot",
+  "poisontail", "covet", "volttackle", "magicalleaf", "watersport", "calmmind",
+  "leafblade", "dragondance", "rockblast", "shockwave", "waterpulse", "doomdesire",
+  "psychoboost",
+};
+static const uint16_t moves_values[] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9,
+  0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13,
+  0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+  0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+  0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31,
+  0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+  0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+  0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+  0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63,
+  0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d,
+  0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+  0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81,
+  0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b,
+  0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95,
+  0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+  0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9,
+  0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3,
+  0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd,
+  0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+  0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1,
+  0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb,
+  0xdc, 0xdd, 0xde, 0xdf, 0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5,
+  0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+  0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+  0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, 0x100, 0x101, 0x102, 0x103,
+  0x104, 0x105, 0x106, 0x107, 0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d,
+  0x10e, 0x10f, 0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+  0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f, 0x120, 0x121,
+  0x122, 0x123, 0x124, 0x125, 0x126, 0x127, 0x128, 0x129, 0x12a, 0x12b,
+  0x12c, 0x12d, 0x12e, 0x12f, 0x130, 0x131, 0x132, 0x133, 0x134, 0x135,
+  0x136, 0x137, 0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+  0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147, 0x148, 0x149,
+  0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f, 0x150, 0x151, 0x152, 0x153,
+  0x154, 0x155, 0x156, 0x157, 0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d,
+  0x15e, 0x15f, 0x160, 0x161, 0x162,
+};
+static const uint16_t moves_seeds[] = {
+  1, 0, 4, 6, 6, 2, 2, 3, 4, 1, 1, 1,
+  7, 1, 7, 1, 1, 1, 3, 4, 4, 2, 2, 1,
+  5, 1, 0, 11, 1, 6, 0, 1, 17, 1, 2, 2,
+  5, 6, 2, 0, 2, 1, 2, 4, 2, 2, 0, 2,
+  3, 11, 32, 2, 1, 1, 3, 3, 2, 5, 3, 1,
+  3, 1, 7, 4, 1, 2, 1, 1, 5, 2, 4, 38,
+  9, 5, 1, 2, 6, 4, 13, 13, 2, 8, 2, 7,
+  3, 1, 29, 4, 1, 36, 1, 12, 7, 1, 31, 9,
+  3, 1, 3, 3, 21, 1, 2, 8, 6, 3, 2, 3,
+  15, 8, 4, 8, 4, 16, 0, 4, 10, 0, 8,
+};
+static const uint16_t moves_slots[] = {
+  306, 193, 28, 294, 71, 336, 211, 282, 133, 4, 24, 202, 0, 181, 263, 233,
+  269, 0, 56, 313, 0, 199, 214, 227, 77, 86, 92, 0, 0, 167, 0, 0,
+  273, 145, 341, 82, 254, 101, 228, 40, 2, 0, 17, 221, 205, 220, 255, 215,
+  317, 210, 0, 223, 161, 79, 126, 0, 256, 0, 0, 84, 0, 147, 113, 192,
+  23, 0, 87, 107, 137, 141, 0, 127, 264, 338, 0, 103, 159, 0, 65, 316,
+  128, 222, 0, 89, 0, 41, 0, 75, 0, 0, 0, 142, 37, 0, 0, 0,
+  288, 149, 213, 285, 0, 152, 45, 144, 0, 242, 0, 180, 347, 339, 0, 0,
+  0, 0, 0, 162, 0, 300, 217, 0, 29, 0, 0, 14, 286, 183, 257, 132,
+  0, 0, 22, 0, 326, 0, 323, 43, 48, 76, 119, 106, 39, 284, 190, 302,
+  95, 111, 130, 0, 27, 33, 0, 62, 301, 104, 0, 129, 105, 349, 292, 0,
+  208, 176, 241, 0, 1, 248, 0, 303, 229, 299, 0, 344, 262, 0, 117, 0,
+  74, 329, 0, 0, 196, 52, 348, 156, 234, 0, 266, 0, 53, 0, 0, 204,
+  0, 0, 279, 0, 44, 36, 21, 265, 94, 240, 0, 78, 97, 244, 0, 224,
+  197, 298, 122, 0, 0, 187, 195, 179, 287, 0, 216, 160, 51, 0, 0, 322,
+  46, 226, 0, 0, 0, 312, 261, 166, 7, 238, 249, 174, 270, 109, 319, 354,
+  0, 0, 0, 58, 61, 121, 346, 231, 0, 330, 0, 252, 151, 155, 304, 275,
+  0, 230, 0, 0, 73, 310, 0, 0, 34, 203, 0, 0, 67, 125, 30, 0,
+  0, 235, 290, 309, 157, 154, 191, 0, 26, 274, 110, 59, 258, 247, 0, 9,
+  321, 237, 100, 0, 177, 0, 0, 68, 0, 271, 260, 297, 175, 0, 0, 172,
+  315, 0, 225, 194, 0, 118, 164, 0, 83, 50, 12, 200, 0, 201, 291, 305,
+  60, 169, 209, 253, 0, 0, 185, 18, 0, 0, 243, 0, 70, 0, 353, 64,
+  148, 0, 259, 85, 350, 72, 0, 163, 331, 178, 327, 88, 0, 66, 80, 143,
+  0, 54, 116, 0, 171, 0, 136, 3, 0, 0, 15, 0, 0, 206, 311, 246,
+  20, 0, 0, 0, 165, 281, 0, 112, 337, 325, 308, 283, 81, 0, 0, 340,
+  351, 318, 219, 25, 131, 250, 138, 343, 93, 236, 0, 0, 268, 0, 332, 295,
+  218, 0, 207, 334, 98, 184, 150, 352, 114, 0, 0, 0, 5, 170, 0, 276,
+  0, 280, 277, 10, 0, 90, 35, 314, 345, 146, 0, 0, 168, 335, 0, 0,
+  31, 188, 135, 8, 0, 13, 0, 307, 11, 232, 0, 120, 0, 278, 124, 333,
+  189, 0, 42, 0, 251, 0, 140, 0, 0, 6, 91, 0, 47, 96, 38, 99,
+  212, 0, 293, 296, 0, 186, 0, 139, 123, 173, 19, 49, 0, 63, 0, 102,
+  289, 355, 0, 16, 0, 57, 0, 153, 0, 0, 158, 55, 267, 108, 328, 272,
+  0, 69, 182, 134, 115, 198, 342, 0, 324, 245, 320, 0, 0, 239, 0, 32,
+};
+const struct NameTable moves_table = {
+  moves_names, moves_keys, moves_values, 355,
+  moves_seeds, 119, moves_slots, 512
+};
+
+static const char *const abilities_names[] = {
+  "None", "Stench", "Drizzle", "Speed Boost",
+  "Battle Armor", "Sturdy", "Damp", "Limber",
+  "Sand Veil", "Static", "Volt Absorb", "Water Absorb",
+  "Oblivious", "Cloud Nine", "Compoundeyes", "Insomnia",
+  "Color Change", "Immunity", "Flash Fire", "Shield Dust",
+  "Own Tempo", "Suction Cups", "Intimidate", "Shadow Tag",
+  "Rough Skin", "Wonder Guard", "Levitate", "Effect Spore",
+  "Synchronize", "Clear Body", "Natural Cure", "Lightningrod",
+  "Serene Grace", "Swift Swim", "Chlorophyll", "Illuminate",
+  "Trace", "Huge Power", "Poison Point", "Inner Focus",
+  "Magma Armor", "Water Veil", "Magnet Pull", "Soundproof",
+  "Rain Dish", "Sand Stream", "Pressure", "Thick Fat",
+  "Early Bird", "Flame Body", "Run Away", "Keen Eye",
+  "Hyper Cutter", "Pickup", "Truant", "Hustle",
+  "Cute Charm", "Plus", "Minus", "Forecast",
+  "Sticky Hold", "Shed Skin", "Guts", "Marvel Scale",
+  "Liquid Ooze", "Overgrow", "Blaze", "Torrent",
+  "Swarm", "Rock Head", "Drought", "Arena Trap",
+  "Vital Spirit", "White Smoke", "Pure Power", "Shell Armor",
+  "Cacophony", "Air Lock",
+};
+static const char *const abilities_keys[] = {
+  "none", "stench", "drizzle", "speedboost", "battlearmor", "sturdy",
+  "damp", "limber", "sandveil", "static", "voltabsorb", "waterabsorb",
+  "oblivious", "cloudnine", "compoundeyes", "insomnia", "colorchange", "immunity",
+  "flashfire", "shielddust", "owntempo", "suctioncups", "intimidate", "shadowtag",
+  "roughskin", "wonderguard", "levitate", "effectspore", "synchronize", "clearbody",
+  "naturalcure", "lightningrod", "serenegrace", "swiftswim", "chlorophyll", "illuminate",
+  "trace", "hugepower", "poisonpoint", "innerfocus", "magmaarmor", "waterveil",
+  "magnetpull", "soundproof", "raindish", "sandstream", "pressure", "thickfat",
+  "earlybird", "flamebody", "runaway", "keeneye", "hypercutter", "pickup",
+  "truant", "hustle", "cutecharm", "plus", "minus", "forecast",
+  "stickyhold", "shedskin", "guts", "marvelscale", "liquidooze", "overgrow",
+  "blaze", "torrent", "swarm", "rockhead", "drought", "arenatrap",
+  "vitalspirit", "whitesmoke", "purepower", "shellarmor", "cacophony", "airlock",
+};
+static const uint16_t abilities_values[] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9,
+  0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13,
+  0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+  0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+  0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31,
+  0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+  0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d,
+};
+static const uint16_t abilities_seeds[] = {
+  2, 1, 1, 3, 7, 1, 2, 4, 4, 1, 1, 6,
+  0, 3, 8, 5, 1, 7, 0, 1, 2, 2, 16, 5,
+  4, 3,
+};
+static const uint16_t abilities_slots[] = {
+  0, 63, 35, 22, 72, 0, 0, 23, 60, 14, 42, 15, 56, 46, 39, 4,
+  59, 53, 30, 74, 49, 0, 0, 0, 5, 0, 0, 70, 45, 52, 0, 28,
+  16, 13, 0, 9, 0, 1, 47, 19, 41, 0, 0, 3, 0, 0, 0, 0,
+  33, 0, 64, 27, 68, 2, 0, 11, 44, 0, 0, 0, 0, 20, 76, 0,
+  69, 24, 25, 0, 0, 58, 0, 67, 0, 48, 6, 31, 10, 78, 0, 12,
+  0, 57, 34, 37, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 77, 51,
+  18, 62, 0, 55, 71, 32, 17, 40, 29, 36, 66, 0, 38, 43, 0, 0,
+  0, 65, 75, 0, 0, 61, 26, 54, 73, 50, 0, 0, 0, 7, 0, 8,
+};
+const struct NameTable abilities_table = {
+  abilities_names, abilities_keys, abilities_values, 78,
+  abilities_seeds, 26, abilities_slots, 128
+};
+
+static const char *const locations_names[] = {
+  "Littleroot Town", "Oldale Town", "Dewford Town", "Lavaridge Town",
+  "Fallarbor Town", "Verdanturf Town", "Pacifidlog Town", "Petalburg City",
+  "Slateport City", "Mauville City", "Rustboro City", "Fortree City",
+  "Lilycove City", "Mossdeep City", "Sootopolis City", "Ever Grande City",
+  "Route 101", "Route 102", "Route 103", "Route 104",
+  "Route 105", "Route 106", "Route 107", "Route 108",
+  "Route 109", "Route 110", "Route 111", "Route 112",
+  "Route 113", "Route 114", "Route 115", "Route 116",
+  "Route 117", "Route 118", "Route 119", "Route 120",
+  "Route 121", "Route 122", "Route 123", "Route 124",
+  "Route 125", "Route 126", "Route 127", "Route 128",
+  "Route 129", "Route 130", "Route 131", "Route 132",
+  "Route 133", "Route 134", "Underwater (124)", "Underwater (126)",
+  "Underwater (127)", "Underwater (128)", "Underwater (Sootopolis)", "Granite Cave",
+  "Mt. Chimney", "Safari Zone", "Battle Frontier", "Petalburg Woods",
+  "Rusturf Tunnel", "Abandoned Ship", "New Mauville", "Meteor Falls",
+  "Mt. Pyre", "Hideout", "Shoal Cave", "Seafloor Cavern",
+  "Underwater (Seafloor Cavern)", "Victory Road", "Mirage Island", "Cave of Origin",
+  "Southern Island", "Fiery Path", "Jagged Pass", "Sealed Chamber",
+  "Underwater (Sealed Chamber)", "Scorched Slab", "Island Cave", "Desert Ruins",
+  "Ancient Tomb", "Inside of Truck", "Sky Pillar", "Secret Base",
+  "Pallet Town", "Viridian City", "Pewter City", "Cerulean City",
+  "Lavender Town", "Vermilion City", "Celadon City", "Fuchsia City",
+  "Cinnabar Island", "Indigo Plateau", "Saffron City", "Route 4 (Pokémon Center)",
+  "Route 10 (Pokémon Center)", "Route 1", "Route 2", "Route 3",
+  "Route 4", "Route 5", "Route 6", "Route 7",
+  "Route 8", "Route 9", "Route 10", "Route 11",
+  "Route 12", "Route 13", "Route 14", "Route 15",
+  "Route 16", "Route 17", "Route 18", "Route 19",
+  "Route 20", "Route 21", "Route 22", "Route 23",
+  "Route 24", "Route 25", "Viridian Forest", "Mt. Moon",
+  "S.S. Anne", "Underground Path (5-6)", "Underground Path (7-8)", "Diglett's Cave",
+  "Victory Road (Kanto)", "Rocket Hideout", "Silph Co.", "Pokémon Mansion",
+  "Safari Zone (Kanto)", "Pokémon League", "Rock Tunnel", "Seafoam Islands",
+  "Pokémon Tower", "Cerulean Cave", "Power Plant", "One Island",
+  "Two Island", "Three Island", "Four Island", "Five Island",
+  "Seven Island", "Six Island", "Kindle Road", "Treasure Beach",
+  "Cape Brink", "Bond Bridge", "Three Isle Port", "Sevii Isle 6",
+  "Sevii Isle 7", "Sevii Isle 8", "Sevii Isle 9", "Resort Gorgeous",
+  "Water Labyrinth", "Five Isle Meadow", "Memorial Pillar", "Outcast Island",
+  "Green Path", "Water Path", "Ruin Valley", "Trainer Tower",
+  "Canyon Entrance", "Sevault Canyon", "Tanoby Ruins", "Sevii Isle 22",
+  "Sevii Isle 23", "Sevii Isle 24", "Navel Rock", "Mt. Ember",
+  "Berry Forest", "Icefall Cave", "Rocket Warehouse", "Dotted Hole",
+  "Lost Cave", "Pattern Bush", "Altering Cave", "Tanoby Chambers",
+  "Three Isle Path", "Tanoby Key", "Birth Island", "Monean Chamber",
+  "Liptoo Chamber", "Weepth Chamber", "Dilford Chamber", "Scufib Chamber",
+  "Rixy Chamber", "Viapois Chamber", "Ember Spa", "Special Area",
+  "Aqua Hideout", "Magma Hideout", "Mirage Tower", "Faraway Island",
+  "Artisan Cave", "Marine Cave", "Underwater (Marine Cave)", "Terra Cave",
+  "Underwater (105)", "Underwater (125)", "Underwater (129)", "Desert Underpass",
+  "Trainer Hill", "In-game Trade", "Fateful Encounter",
+};
+static const char *const locations_keys[] = {
+  "littleroottown", "oldaletown", "dewfordtown", "lavaridgetown", "fallarbortown", "verdanturftown",
+  "pacifidlogtown", "petalburgcity", "slateportcity", "mauvillecity", "rustborocity", "fortreecity",
+  "lilycovecity", "mossdeepcity", "sootopoliscity", "evergrandecity", "route101", "route102",
+  "route103", "route104", "route105", "route106", "route107", "route108",
+  "route109", "route110", "route111", "route112", "route113", "route114",
+  "route115", "route116", "route117", "route118", "route119", "route120",
+  "route121", "route122", "route123", "route124", "route125", "route126",
+  "route127", "route128", "route129", "route130", "route131", "route132",
+  "route133", "route134", "underwater124", "underwater126", "underwater127", "underwater128",
+  "underwatersootopolis", "granitecave", "mtchimney", "safarizone", "battlefrontier", "petalburgwoods",
+  "rusturftunnel", "abandonedship", "newmauville", "meteorfalls", "mtpyre", "hideout",
+  "shoalcave", "seafloorcavern", "underwaterseafloorcavern", "victoryroad", "mirageisland", "caveoforigin",
+  "southernisland", "fierypath", "jaggedpass", "sealedchamber", "underwatersealedchamber", "scorchedslab",
+  "islandcave", "desertruins", "ancienttomb", "insideoftruck", "skypillar", "secretbase",
+  "pallettown", "viridiancity", "pewtercity", "ceruleancity", "lavendertown", "vermilioncity",
+  "celadoncity", "fuchsiacity", "cinnabarisland", "indigoplateau", "saffroncity", "route4pokemoncenter",
+  "route10pokemoncenter", "route1", "route2", "route3", "route4", "route5",
+  "route6", "route7", "route8", "route9", "route10", "route11",
+  "route12", "route13", "route14", "route15", "route16", "route17",
+  "route18", "route19", "route20", "route21", "route22", "route23",
+  "route24", "route25", "viridianforest", "mtmoon", "ssanne", "undergroundpath56",
+  "undergroundpath78", "diglettscave", "victoryroadkanto", "rockethideout", "silphco", "pokemonmansion",
+  "safarizonekanto", "pokemonleague", "rocktunnel", "seafoamislands", "pokemontower", "ceruleancave",
+  "powerplant", "oneisland", "twoisland", "threeisland", "fourisland", "fiveisland",
+  "sevenisland", "sixisland", "kindleroad", "treasurebeach", "capebrink", "bondbridge",
+  "threeisleport", "seviiisle6", "seviiisle7", "seviiisle8", "seviiisle9", "resortgorgeous",
+  "waterlabyrinth", "fiveislemeadow", "memorialpillar", "outcastisland", "greenpath", "waterpath",
+  "ruinvalley", "trainertower", "canyonentrance", "sevaultcanyon", "tanobyruins", "seviiisle22",
+  "seviiisle23", "seviiisle24", "navelrock", "mtember", "berryforest", "icefallcave",
+  "rocketwarehouse", "dottedhole", "lostcave", "patternbush", "alteringcave", "tanobychambers",
+  "threeislepath", "tanobykey", "birthisland", "moneanchamber", "liptoochamber", "weepthchamber",
+  "dilfordchamber", "scufibchamber", "rixychamber", "viapoischamber", "emberspa", "specialarea",
+  "aquahideout", "magmahideout", "miragetower", "farawayisland", "artisancave", "marinecave",
+  "underwatermarinecave", "terracave", "underwater105", "underwater125", "underwater129", "desertunderpass",
+  "trainerhill", "ingametrade", "fatefulencounter",
+};
+static const uint16_t locations_values[] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9,
+  0xa, 0xb, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11, 0x12, 0x13,
+  0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d,
+  0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+  0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31,
+  0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+  0x3c, 0x3d, 0x3e, 0x3f, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+  0x47, 0x48, 0x49, 0x4a, 0x4c, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+  0x53, 0x54, 0x55, 0x56, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d,
+  0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+  0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
+  0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
+  0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+  0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+  0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2, 0xa3,
+  0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad,
+  0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8,
+  0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf, 0xc0, 0xc1, 0xc2,
+  0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc9, 0xca, 0xcb, 0xcc, 0xcd,
+  0xce, 0xcf, 0xd0, 0xd1, 0xd4, 0xfe, 0xff,
+};
+static const uint16_t locations_seeds[] = {
+  1, 3, 1, 1, 2, 5, 1, 1, 1, 3, 2, 1,
+  1, 1, 2, 1, 1, 0, 5, 1, 1, 2, 1, 2,
+  1, 2, 1, 4, 1, 2, 1, 0, 2, 2, 1, 9,
+  1, 3, 1, 1, 1, 2, 0, 2, 3, 1, 2, 0,
+  2, 2, 1, 3, 1, 8, 2, 3, 1, 3, 1, 1,
+  2, 6, 1, 3, 2, 3, 1, 1, 1,
+};
+static const uint16_t locations_slots[] = {
+  0, 0, 0, 0, 0, 53, 32, 0, 177, 0, 125, 0, 0, 188, 72, 130,
+  197, 0, 0, 140, 25, 0, 0, 0, 0, 0, 0, 98, 0, 0, 178, 0,
+  0, 185, 153, 0, 0, 0, 0, 0, 0, 0, 0, 69, 102, 0, 194, 86,
+  0, 0, 48, 0, 12, 0, 41, 109, 0, 95, 0, 0, 0, 203, 0, 0,
+  3, 35, 0, 33, 0, 0, 0, 0, 118, 0, 46, 0, 15, 202, 0, 0,
+  161, 166, 127, 168, 0, 156, 0, 201, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 124, 167, 0, 198, 0, 52, 0, 136, 84, 0, 0, 169, 64, 0,
+  55, 1, 0, 0, 39, 0, 187, 79, 62, 0, 0, 204, 0, 0, 76, 44,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 0, 30, 0, 0, 132,
+  173, 9, 139, 0, 0, 123, 0, 0, 0, 0, 0, 195, 0, 14, 149, 0,
+  2, 174, 0, 0, 0, 145, 82, 120, 150, 0, 99, 0, 181, 0, 151, 191,
+  131, 91, 0, 0, 0, 0, 0, 18, 170, 97, 0, 0, 0, 0, 60, 0,
+  88, 0, 42, 40, 104, 0, 0, 54, 51, 68, 193, 0, 0, 0, 0, 171,
+  100, 0, 0, 0, 0, 146, 0, 19, 0, 0, 0, 162, 0, 0, 0, 85,
+  0, 0, 138, 0, 67, 66, 94, 106, 0, 73, 0, 0, 196, 77, 172, 0,
+  10, 0, 0, 0, 0, 0, 47, 43, 0, 74, 13, 0, 0, 27, 0, 56,
+  0, 45, 22, 0, 57, 0, 0, 23, 0, 154, 117, 81, 0, 92, 158, 122,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190, 112, 0, 0, 0, 0,
+  0, 0, 107, 0, 4, 0, 0, 0, 0, 0, 0, 0, 115, 114, 89, 0,
+  113, 0, 129, 0, 0, 155, 147, 96, 0, 0, 0, 11, 144, 0, 0, 116,
+  137, 148, 17, 143, 0, 192, 0, 0, 70, 0, 0, 61, 75, 0, 0, 0,
+  163, 0, 0, 63, 0, 90, 0, 0, 0, 119, 0, 179, 152, 159, 0, 0,
+  0, 0, 0, 108, 0, 0, 0, 175, 65, 0, 0, 0, 128, 0, 36, 0,
+  0, 5, 0, 157, 0, 0, 0, 0, 28, 0, 0, 0, 176, 141, 135, 0,
+  7, 0, 38, 0, 49, 0, 126, 80, 206, 87, 0, 0, 0, 0, 199, 0,
+  71, 0, 0, 0, 0, 0, 0, 16, 121, 34, 160, 0, 0, 207, 0, 0,
+  8, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  50, 189, 0, 0, 182, 21, 37, 0, 0, 0, 0, 93, 0, 0, 142, 105,
+  0, 110, 0, 180, 0, 0, 78, 0, 59, 0, 0, 0, 101, 0, 200, 0,
+  0, 0, 83, 0, 0, 0, 205, 164, 0, 0, 186, 0, 0, 0, 24, 0,
+  0, 0, 0, 0, 20, 165, 0, 183, 26, 6, 29, 0, 0, 103, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 184, 0, 0, 0, 134, 111, 0, 31, 0,
+};
+const struct NameTable locations_table = {
+  locations_names, locations_keys, locations_values, 207,
+  locations_seeds, 69, locations_slots, 512
+};
+
+static const char *const games_names[] = {
+  "colosseum-bonus", "sapphire", "ruby", "emerald",
+  "firered", "leafgreen", "colosseum-xd",
+};
+static const char *const games_keys[] = {
+  "colosseumbonus", "sapphire", "ruby", "emerald", "firered", "leafgreen",
+  "colosseumxd",
+};
+static const uint16_t games_values[] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0xf,
+};
+static const uint16_t games_seeds[] = {
+  1, 1, 1,
+};
+static const uint16_t games_slots[] = {
+  0, 0, 0, 6, 0, 0, 0, 0, 5, 2, 1, 4, 3, 7, 0, 0,
+};
+const struct NameTable games_table = {
+  games_names, games_keys, games_values, 7,
+  games_seeds, 3, games_slots, 16
+};
+
+static const char *const balls_names[] = {
+  "master", "ultra", "great", "standard",
+  "safari", "net", "dive", "nest",
+  "repeat", "timer", "luxury", "premier",
+};
+static const char *const balls_keys[] = {
+  "master", "ultra", "great", "standard", "safari", "net",
+  "dive", "nest", "repeat", "timer", "luxury", "premier",
+};
+static const uint16_t balls_values[] = {
+  0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xa,
+  0xb, 0xc,
+};
+static const uint16_t balls_seeds[] = {
+  3, 5, 1, 1,
+};
+static const uint16_t balls_slots[] = {
+  8, 2, 12, 1, 0, 5, 0, 11, 0, 10, 3, 4, 6, 9, 7, 0,
+};
+const struct NameTable balls_table = {
+  balls_names, balls_keys, balls_values, 12,
+  balls_seeds, 4, balls_slots, 16
+};
+
+static const char *const languages_names[] = {
+  "ja", "en", "fr", "it",
+  "de", "ko", "es",
+};
+static const char *const languages_keys[] = {
+  "ja", "en", "fr", "it", "de", "ko",
+  "es",
+};
+static const uint16_t languages_values[] = {
+  0x201, 0x202, 0x203, 0x204, 0x205, 0x206, 0x207,
+};
+static const uint16_t languages_seeds[] = {
+  1, 1, 5,
+};
+static const uint16_t languages_slots[] = {
+  6, 2, 5, 0, 3, 0, 0, 1, 7, 0, 0, 0, 0, 0, 0, 4,
+};
+const struct NameTable languages_table = {
+  languages_names, languages_keys, languages_values, 7,
+  languages_seeds, 3, languages_slots, 16
+};
+
+static const char *const growth_names[] = {
+  "medium-fast", "erratic", "fluctuating", "medium-slow",
+  "fast", "slow",
+};
+static const char *const growth_keys[] = {
+  "mediumfast", "erratic", "fluctuating", "mediumslow", "fast", "slow",
+};
+static const uint16_t growth_values[] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5,
+};
+static const uint16_t growth_seeds[] = {
+  1, 1,
+};
+static const uint16_t growth_slots[] = {
+  2, 3, 6, 0, 5, 4, 1, 0,
+};
+const struct NameTable growth_table = {
+  growth_names, growth_keys, growth_values, 6,
+  growth_seeds, 2, growth_slots, 8
+};
+
+const struct SpeciesInfo species_info[SPECIES_COUNT] = {
+  [1] = {{45, 49, 49, 45, 65, 65}, 3}, // Bulbasaur
+  [2] = {{60, 62, 63, 60, 80, 80}, 3}, // Ivysaur
+  [3] = {{80, 82, 83, 80, 100, 100}, 3}, // Venusaur
+  [4] = {{39, 52, 43, 65, 60, 50}, 3}, // Charmander
+  [5] = {{58, 64, 58, 80, 80, 65}, 3}, // Charmeleon
+  [6] = {{78, 84, 78, 100, 109, 85}, 3}, // Charizard
+  [7] = {{44, 48, 65, 43, 50, 64}, 3}, // Squirtle
+  [8] = {{59, 63, 80, 58, 65, 80}, 3}, // Wartortle
+  [9] = {{79, 83, 100, 78, 85, 105}, 3}, // Blastoise
+  [10] = {{45, 30, 35, 45, 20, 20}, 0}, // Caterpie
+  [11] = {{50, 20, 55, 30, 25, 25}, 0}, // Metapod
+  [12] = {{60, 45, 50, 70, 80, 80}, 0}, // Butterfree
+  [13] = {{40, 35, 30, 50, 20, 20}, 0}, // Weedle
+  [14] = {{45, 25, 50, 35, 25, 25}, 0}, // Kakuna
+  [15] = {{65, 80, 40, 75, 45, 80}, 0}, // Beedrill
+  [16] = {{40, 45, 40, 56, 35, 35}, 3}, // Pidgey
+  [17] = {{63, 60, 55, 71, 50, 50}, 3}, // Pidgeotto
+  [18] = {{83, 80, 75, 91, 70, 70}, 3}, // Pidgeot
+  [19] = {{30, 56, 35, 72, 25, 35}, 0}, // Rattata
+  [20] = {{55, 81, 60, 97, 50, 70}, 0}, // Raticate
+  [21] = {{40, 60, 30, 70, 31, 31}, 0}, // Spearow
+  [22] = {{65, 90, 65, 100, 61, 61}, 0}, // Fearow
+  [23] = {{35, 60, 44, 55, 40, 54}, 0}, // Ekans
+  [24] = {{60, 85, 69, 80, 65, 79}, 0}, // Arbok
+  [25] = {{35, 55, 30, 90, 50, 40}, 0}, // Pikachu
+  [26] = {{60, 90, 55, 100, 90, 80}, 0}, // Raichu
+  [27] = {{50, 75, 85, 40, 20, 30}, 0}, // Sandshrew
+  [28] = {{75, 100, 110, 65, 45, 55}, 0}, // Sandslash
+  [29] = {{55, 47, 52, 41, 40, 40}, 3}, // Nidoran♀
+  [30] = {{70, 62, 67, 56, 55, 55}, 3}, // Nidorina
+  [31] = {{90, 82, 87, 76, 75, 85}, 3}, // Nidoqueen
+  [32] = {{46, 57, 40, 50, 40, 40}, 3}, // Nidoran♂
+  [33] = {{61, 72, 57, 65, 55, 55}, 3}, // Nidorino
+  [34] = {{81, 92, 77, 85, 85, 75}, 3}, // Nidoking
+  [35] = {{70, 45, 48, 35, 60, 65}, 4}, // Clefairy
+  [36] = {{95, 70, 73, 60, 85, 90}, 4}, // Clefable
+  [37] = {{38, 41, 40, 65, 50, 65}, 0}, // Vulpix
+  [38] = {{73, 76, 75, 100, 81, 100}, 0}, // Ninetales
+  [39] = {{115, 45, 20, 20, 45, 25}, 4}, // Jigglypuff
+  [40] = {{140, 70, 45, 45, 75, 50}, 4}, // Wigglytuff
+  [41] = {{40, 45, 35, 55, 30, 40}, 0}, // Zubat
+  [42] = {{75, 80, 70, 90, 65, 75}, 0}, // Golbat
+  [43] = {{45, 50, 55, 30, 75, 65}, 3}, // Oddish
+  [44] = {{60, 65, 70, 40, 85, 75}, 3}, // Gloom
+  [45] = {{75, 80, 85, 50, 100, 90}, 3}, // Vileplume
+  [46] = {{35, 70, 55, 25, 45, 55}, 0}, // Paras
+  [47] = {{60, 95, 80, 30, 60, 80}, 0}, // Parasect
+  [48] = {{60, 55, 50, 45, 40, 55}, 0}, // Venonat
+  [49] = {{70, 65, 60, 90, 90, 75}, 0}, // Venomoth
+  [50] = {{10, 55, 25, 95, 35, 45}, 0}, // Diglett
+  [51] = {{35, 80, 50, 120, 50, 70}, 0}, // Dugtrio
+  [52] = {{40, 45, 35, 90, 40, 40}, 0}, // Meowth
+  [53] = {{65, 70, 60, 115, 65, 65}, 0}, // Persian
+  [54] = {{50, 52, 48, 55, 65, 50}, 0}, // Psyduck
+  [55] = {{80, 82, 78, 85, 95, 80}, 0}, // Golduck
+  [56] = {{40, 80, 35, 70, 35, 45}, 0}, // Mankey
+  [57] = {{65, 105, 60, 95, 60, 70}, 0}, // Primeape
+  [58] = {{55, 70, 45, 60, 70, 50}, 5}, // Growlithe
+  [59] = {{90, 110, 80, 95, 100, 80}, 5}, // Arcanine
+  [60] = {{40, 50, 40, 90, 40, 40}, 3}, // Poliwag
+  [61] = {{65, 65, 65, 90, 50, 50}, 3}, // Poliwhirl
+  [62] = {{90, 85, 95, 70, 70, 90}, 3}, // Poliwrath
+  [63] = {{25, 20, 15, 90, 105, 55}, 3}, // Abra
+  [64] = {{40, 35, 30, 105, 120, 70}, 3}, // Kadabra
+  [65] = {{55, 50, 45, 120, 135, 85}, 3}, // Alakazam
+  [66] = {{70, 80, 50, 35, 35, 35}, 3}, // Machop
+  [67] = {{80, 100, 70, 45, 50, 60}, 3}, // Machoke
+  [68] = {{90, 130, 80, 55, 65, 85}, 3}, // Machamp
+  [69] = {{50, 75, 35, 40, 70, 30}, 3}, // Bellsprout
+  [70] = {{65, 90, 50, 55, 85, 45}, 3}, // Weepinbell
+  [71] = {{80, 105, 65, 70, 100, 60}, 3}, // Victreebel
+  [72] = {{40, 40, 35, 70, 50, 100}, 5}, // Tentacool
+  [73] = {{80, 70, 65, 100, 80, 120}, 5}, // Tentacruel
+  [74] = {{40, 80, 100, 20, 30, 30}, 3}, // Geodude
+  [75] = {{55, 95, 115, 35, 45, 45}, 3}, // Graveler
+  [76] = {{80, 110, 130, 45, 55, 65}, 3}, // Golem
+  [77] = {{50, 85, 55, 90, 65, 65}, 0}, // Ponyta
+  [78] = {{65, 100, 70, 105, 80, 80}, 0}, // Rapidash
+  [79] = {{90, 65, 65, 15, 40, 40}, 0}, // Slowpoke
+  [80] = {{95, 75, 110, 30, 100, 80}, 0}, // Slowbro
+  [81] = {{25, 35, 70, 45, 95, 55}, 0}, // Magnemite
+  [82] = {{50, 60, 95, 70, 120, 70}, 0}, // Magneton
+  [83] = {{52, 65, 55, 60, 58, 62}, 0}, // Farfetch'd
+  [84] = {{35, 85, 45, 75, 35, 35}, 0}, // Doduo
+  [85] = {{60, 110, 70, 100, 60, 60}, 0}, // Dodrio
+  [86] = {{65, 45, 55, 45, 45, 70}, 0}, // Seel
+  [87] = {{90, 70, 80, 70, 70, 95}, 0}, // Dewgong
+  [88] = {{80, 80, 50, 25, 40, 50}, 0}, // Grimer
+  [89] = {{105, 105, 75, 50, 65, 100}, 0}, // Muk
+  [90] = {{30, 65, 100, 40, 45, 25}, 5}, // Shellder
+  [91] = {{50, 95, 180, 70, 85, 45}, 5}, // Cloyster
+  [92] = {{30, 35, 30, 80, 100, 35}, 3}, // Gastly
+  [93] = {{45, 50, 45, 95, 115, 55}, 3}, // Haunter
+  [94] = {{60, 65, 60, 110, 130, 75}, 3}, // Gengar
+  [95] = {{35, 45, 160, 70, 30, 45}, 0}, // Onix
+  [96] = {{60, 48, 45, 42, 43, 90}, 0}, // Drowzee
+  [97] = {{85, 73, 70, 67, 73, 115}, 0}, // Hypno
+  [98] = {{30, 105, 90, 50, 25, 25}, 0}, // Krabby
+  [99] = {{55, 130, 115, 75, 50, 50}, 0}, // Kingler
+  [100] = {{40, 30, 50, 100, 55, 55}, 0}, // Voltorb
+  [101] = {{60, 50, 70, 140, 80, 80}, 0}, // Electrode
+  [102] = {{60, 40, 80, 40, 60, 45}, 5}, // Exeggcute
+  [103] = {{95, 95, 85, 55, 125, 65}, 5}, // Exeggutor
+  [104] = {{50, 50, 95, 35, 40, 50}, 0}, // Cubone
+  [105] = {{60, 80, 110, 45, 50, 80}, 0}, // Marowak
+  [106] = {{50, 120, 53, 87, 35, 110}, 0}, // Hitmonlee
+  [107] = {{50, 105, 79, 76, 35, 110}, 0}, // Hitmonchan
+  [108] = {{90, 55, 75, 30, 60, 75}, 0}, // Lickitung
+  [109] = {{40, 65, 95, 35, 60, 45}, 0}, // Koffing
+  [110] = {{65, 90, 120, 60, 85, 70}, 0}, // Weezing
+  [111] = {{80, 85, 95, 25, 30, 30}, 5}, // Rhyhorn
+  [112] = {{105, 130, 120, 40, 45, 45}, 5}, // Rhydon
+  [113] = {{250, 5, 5, 50, 35, 105}, 4}, // Chansey
+  [114] = {{65, 55, 115, 60, 100, 40}, 0}, // Tangela
+  [115] = {{105, 95, 80, 90, 40, 80}, 0}, // Kangaskhan
+  [116] = {{30, 40, 70, 60, 70, 25}, 0}, // Horsea
+  [117] = {{55, 65, 95, 85, 95, 45}, 0}, // Seadra
+  [118] = {{45, 67, 60, 63, 35, 50}, 0}, // Goldeen
+  [119] = {{80, 92, 65, 68, 65, 80}, 0}, // Seaking
+  [120] = {{30, 45, 55, 85, 70, 55}, 5}, // Staryu
+  [121] = {{60, 75, 85, 115, 100, 85}, 5}, // Starmie
+  [122] = {{40, 45, 65, 90, 100, 120}, 0}, // Mr. Mime
+  [123] = {{70, 110, 80, 105, 55, 80}, 0}, // Scyther
+  [124] = {{65, 50, 35, 95, 115, 95}, 0}, // Jynx
+  [125] = {{65, 83, 57, 105, 95, 85}, 0}, // Electabuzz
+  [126] = {{65, 95, 57, 93, 100, 85}, 0}, // Magmar
+  [127] = {{65, 125, 100, 85, 55, 70}, 5}, // Pinsir
+  [128] = {{75, 100, 95, 110, 40, 70}, 5}, // Tauros
+  [129] = {{20, 10, 55, 80, 15, 20}, 5}, // Magikarp
+  [130] = {{95, 125, 79, 81, 60, 100}, 5}, // Gyarados
+  [131] = {{130, 85, 80, 60, 85, 95}, 5}, // Lapras
+  [132] = {{48, 48, 48, 48, 48, 48}, 0}, // Ditto
+  [133] = {{55, 55, 50, 55, 45, 65}, 0}, // Eevee
+  [134] = {{130, 65, 60, 65, 110, 95}, 0}, // Vaporeon
+  [135] = {{65, 65, 60, 130, 110, 95}, 0}, // Jolteon
+  [136] = {{65, 130, 60, 65, 95, 110}, 0}, // Flareon
+  [137] = {{65, 60, 70, 40, 85, 75}, 0}, // Porygon
+  [138] = {{35, 40, 100, 35, 90, 55}, 0}, // Omanyte
+  [139] = {{70, 60, 125, 55, 115, 70}, 0}, // Omastar
+  [140] = {{30, 80, 90, 55, 55, 45}, 0}, // Kabuto
+  [141] = {{60, 115, 105, 80, 65, 70}, 0}, // Kabutops
+  [142] = {{80, 105, 65, 130, 60, 75}, 5}, // Aerodactyl
+  [143] = {{160, 110, 65, 30, 65, 110}, 5}, // Snorlax
+  [144] = {{90, 85, 100, 85, 95, 125}, 5}, // Articuno
+  [145] = {{90, 90, 85, 100, 125, 90}, 5}, // Zapdos
+  [146] = {{90, 100, 90, 90, 125, 85}, 5}, // Moltres
+  [147] = {{41, 64, 45, 50, 50, 50}, 5}, // Dratini
+  [148] = {{61, 84, 65, 70, 70, 70}, 5}, // Dragonair
+  [149] = {{91, 134, 95, 80, 100, 100}, 5}, // Dragonite
+  [150] = {{106, 110, 90, 130, 154, 90}, 5}, // Mewtwo
+  [151] = {{100, 100, 100, 100, 100, 100}, 3}, // Mew
+  [152] = {{45, 49, 65, 45, 49, 65}, 3}, // Chikorita
+  [153] = {{60, 62, 80, 60, 63, 80}, 3}, // Bayleef
+  [154] = {{80, 82, 100, 80, 83, 100}, 3}, // Meganium
+  [155] = {{39, 52, 43, 65, 60, 50}, 3}, // Cyndaquil
+  [156] = {{58, 64, 58, 80, 80, 65}, 3}, // Quilava
+  [157] = {{78, 84, 78, 100, 109, 85}, 3}, // Typhlosion
+  [158] = {{50, 65, 64, 43, 44, 48}, 3}, // Totodile
+  [159] = {{65, 80, 80, 58, 59, 63}, 3}, // Croconaw
+  [160] = {{85, 105, 100, 78, 79, 83}, 3}, // Feraligatr
+  [161] = {{35, 46, 34, 20, 35, 45}, 0}, // Sentret
+  [162] = {{85, 76, 64, 90, 45, 55}, 0}, // Furret
+  [163] = {{60, 30, 30, 50, 36, 56}, 0}, // Hoothoot
+  [164] = {{100, 50, 50, 70, 76, 96}, 0}, // Noctowl
+  [165] = {{40, 20, 30, 55, 40, 80}, 4}, // Ledyba
+  [166] = {{55, 35, 50, 85, 55, 110}, 4}, // Ledian
+  [167] = {{40, 60, 40, 30, 40, 40}, 4}, // Spinarak
+  [168] = {{70, 90, 70, 40, 60, 60}, 4}, // Ariados
+  [169] = {{85, 90, 80, 130, 70, 80}, 0}, // Crobat
+  [170] = {{75, 38, 38, 67, 56, 56}, 5}, // Chinchou
+  [171] = {{125, 58, 58, 67, 76, 76}, 5}, // Lanturn
+  [172] = {{20, 40, 15, 60, 35, 35}, 0}, // Pichu
+  [173] = {{50, 25, 28, 15, 45, 55}, 4}, // Cleffa
+  [174] = {{90, 30, 15, 15, 40, 20}, 4}, // Igglybuff
+  [175] = {{35, 20, 65, 20, 40, 65}, 4}, // Togepi
+  [176] = {{55, 40, 85, 40, 80, 105}, 4}, // Togetic
+  [177] = {{40, 50, 45, 70, 70, 45}, 0}, // Natu
+  [178] = {{65, 75, 70, 95, 95, 70}, 0}, // Xatu
+  [179] = {{55, 40, 40, 35, 65, 45}, 3}, // Mareep
+  [180] = {{70, 55, 55, 45, 80, 60}, 3}, // Flaaffy
+  [181] = {{90, 75, 75, 55, 115, 90}, 3}, // Ampharos
+  [182] = {{75, 80, 85, 50, 90, 100}, 3}, // Bellossom
+  [183] = {{70, 20, 50, 40, 20, 50}, 4}, // Marill
+  [184] = {{100, 50, 80, 50, 50, 80}, 4}, // Azumarill
+  [185] = {{70, 100, 115, 30, 30, 65}, 0}, // Sudowoodo
+  [186] = {{90, 75, 75, 70, 90, 100}, 3}, // Politoed
+  [187] = {{35, 35, 40, 50, 35, 55}, 3}, // Hoppip
+  [188] = {{55, 45, 50, 80, 45, 65}, 3}, // Skiploom
+  [189] = {{75, 55, 70, 110, 55, 85}, 3}, // Jumpluff
+  [190] = {{55, 70, 55, 85, 40, 55}, 4}, // Aipom
+  [191] = {{30, 30, 30, 30, 30, 30}, 3}, // Sunkern
+  [192] = {{75, 75, 55, 30, 105, 85}, 3}, // Sunflora
+  [193] = {{65, 65, 45, 95, 75, 45}, 0}, // Yanma
+  [194] = {{55, 45, 45, 15, 25, 25}, 0}, // Wooper
+  [195] = {{95, 85, 85, 35, 65, 65}, 0}, // Quagsire
+  [196] = {{65, 65, 60, 110, 130, 95}, 0}, // Espeon
+  [197] = {{95, 65, 110, 65, 60, 130}, 0}, // Umbreon
+  [198] = {{60, 85, 42, 91, 85, 42}, 3}, // Murkrow
+  [199] = {{95, 75, 80, 30, 100, 110}, 0}, // Slowking
+  [200] = {{60, 60, 60, 85, 85, 85}, 4}, // Misdreavus
+  [201] = {{48, 72, 48, 48, 72, 48}, 0}, // Unown
+  [202] = {{190, 33, 58, 33, 33, 58}, 0}, // Wobbuffet
+  [203] = {{70, 80, 65, 85, 90, 65}, 0}, // Girafarig
+  [204] = {{50, 65, 90, 15, 35, 35}, 0}, // Pineco
+  [205] = {{75, 90, 140, 40, 60, 60}, 0}, // Forretress
+  [206] = {{100, 70, 70, 45, 65, 65}, 0}, // Dunsparce
+  [207] = {{65, 75, 105, 85, 35, 65}, 3}, // Gligar
+  [208] = {{75, 85, 200, 30, 55, 65}, 0}, // Steelix
+  [209] = {{60, 80, 50, 30, 40, 40}, 4}, // Snubbull
+  [210] = {{90, 120, 75, 45, 60, 60}, 4}, // Granbull
+  [211] = {{65, 95, 75, 85, 55, 55}, 0}, // Qwilfish
+  [212] = {{70, 130, 100, 65, 55, 80}, 0}, // Scizor
+  [213] = {{20, 10, 230, 5, 10, 230}, 3}, // Shuckle
+  [214] = {{80, 125, 75, 85, 40, 95}, 5}, // Heracross
+  [215] = {{55, 95, 55, 115, 35, 75}, 3}, // Sneasel
+  [216] = {{60, 80, 50, 40, 50, 50}, 0}, // Teddiursa
+  [217] = {{90, 130, 75, 55, 75, 75}, 0}, // Ursaring
+  [218] = {{40, 40, 40, 20, 70, 40}, 0}, // Slugma
+  [219] = {{50, 50, 120, 30, 80, 80}, 0}, // Magcargo
+  [220] = {{50, 50, 40, 50, 30, 30}, 5}, // Swinub
+  [221] = {{100, 100, 80, 50, 60, 60}, 5}, // Piloswine
+  [222] = {{55, 55, 85, 35, 65, 85}, 4}, // Corsola
+  [223] = {{35, 65, 35, 65, 65, 35}, 0}, // Remoraid
+  [224] = {{75, 105, 75, 45, 105, 75}, 0}, // Octillery
+  [225] = {{45, 55, 45, 75, 65, 45}, 4}, // Delibird
+  [226] = {{65, 40, 70, 70, 80, 140}, 5}, // Mantine
+  [227] = {{65, 80, 140, 70, 40, 70}, 5}, // Skarmory
+  [228] = {{45, 60, 30, 65, 80, 50}, 5}, // Houndour
+  [229] = {{75, 90, 50, 95, 110, 80}, 5}, // Houndoom
+  [230] = {{75, 95, 95, 85, 95, 95}, 0}, // Kingdra
+  [231] = {{90, 60, 60, 40, 40, 40}, 0}, // Phanpy
+  [232] = {{90, 120, 120, 50, 60, 60}, 0}, // Donphan
+  [233] = {{85, 80, 90, 60, 105, 95}, 0}, // Porygon2
+  [234] = {{73, 95, 62, 85, 85, 65}, 5}, // Stantler
+  [235] = {{55, 20, 35, 75, 20, 45}, 4}, // Smeargle
+  [236] = {{35, 35, 35, 35, 35, 35}, 0}, // Tyrogue
+  [237] = {{50, 95, 95, 70, 35, 110}, 0}, // Hitmontop
+  [238] = {{45, 30, 15, 65, 85, 65}, 0}, // Smoochum
+  [239] = {{45, 63, 37, 95, 65, 55}, 0}, // Elekid
+  [240] = {{45, 75, 37, 83, 70, 55}, 0}, // Magby
+  [241] = {{95, 80, 105, 100, 40, 70}, 5}, // Miltank
+  [242] = {{255, 10, 10, 55, 75, 135}, 4}, // Blissey
+  [243] = {{90, 85, 75, 115, 115, 100}, 5}, // Raikou
+  [244] = {{115, 115, 85, 100, 90, 75}, 5}, // Entei
+  [245] = {{100, 75, 115, 85, 90, 115}, 5}, // Suicune
+  [246] = {{50, 64, 50, 41, 45, 50}, 5}, // Larvitar
+  [247] = {{70, 84, 70, 51, 65, 70}, 5}, // Pupitar
+  [248] = {{100, 134, 110, 61, 95, 100}, 5}, // Tyranitar
+  [249] = {{106, 90, 130, 110, 90, 154}, 5}, // Lugia
+  [250] = {{106, 130, 90, 90, 110, 154}, 5}, // Ho-Oh
+  [251] = {{100, 100, 100, 100, 100, 100}, 3}, // Celebi
+  [277] = {{40, 45, 35, 70, 65, 55}, 3}, // Treecko
+  [278] = {{50, 65, 45, 95, 85, 65}, 3}, // Grovyle
+  [279] = {{70, 85, 65, 120, 105, 85}, 3}, // Sceptile
+  [280] = {{45, 60, 40, 45, 70, 50}, 3}, // Torchic
+  [281] = {{60, 85, 60, 55, 85, 60}, 3}, // Combusken
+  [282] = {{80, 120, 70, 80, 110, 70}, 3}, // Blaziken
+  [283] = {{50, 70, 50, 40, 50, 50}, 3}, // Mudkip
+  [284] = {{70, 85, 70, 50, 60, 70}, 3}, // Marshtomp
+  [285] = {{100, 110, 90, 60, 85, 90}, 3}, // Swampert
+  [286] = {{35, 55, 35, 35, 30, 30}, 0}, // Poochyena
+  [287] = {{70, 90, 70, 70, 60, 60}, 0}, // Mightyena
+  [288] = {{38, 30, 41, 60, 30, 41}, 0}, // Zigzagoon
+  [289] = {{78, 70, 61, 100, 50, 61}, 0}, // Linoone
+  [290] = {{45, 45, 35, 20, 20, 30}, 0}, // Wurmple
+  [291] = {{50, 35, 55, 15, 25, 25}, 0}, // Silcoon
+  [292] = {{60, 70, 50, 65, 90, 50}, 0}, // Beautifly
+  [293] = {{50, 35, 55, 15, 25, 25}, 0}, // Cascoon
+  [294] = {{60, 50, 70, 65, 50, 90}, 0}, // Dustox
+  [295] = {{40, 30, 30, 30, 40, 50}, 3}, // Lotad
+  [296] = {{60, 50, 50, 50, 60, 70}, 3}, // Lombre
+  [297] = {{80, 70, 70, 70, 90, 100}, 3}, // Ludicolo
+  [298] = {{40, 40, 50, 30, 30, 30}, 3}, // Seedot
+  [299] = {{70, 70, 40, 60, 60, 40}, 3}, // Nuzleaf
+  [300] = {{90, 100, 60, 80, 90, 60}, 3}, // Shiftry
+  [301] = {{31, 45, 90, 40, 30, 30}, 1}, // Nincada
+  [302] = {{61, 90, 45, 160, 50, 50}, 1}, // Ninjask
+  [303] = {{1, 90, 45, 40, 30, 30}, 1}, // Shedinja
+  [304] = {{40, 55, 30, 85, 30, 30}, 3}, // Taillow
+  [305] = {{60, 85, 60, 125, 50, 50}, 3}, // Swellow
+  [306] = {{60, 40, 60, 35, 40, 60}, 2}, // Shroomish
+  [307] = {{60, 130, 80, 70, 60, 60}, 2}, // Breloom
+  [308] = {{60, 60, 60, 60, 60, 60}, 4}, // Spinda
+  [309] = {{40, 30, 30, 85, 55, 30}, 0}, // Wingull
+  [310] = {{60, 50, 100, 65, 85, 70}, 0}, // Pelipper
+  [311] = {{40, 30, 32, 65, 50, 52}, 0}, // Surskit
+  [312] = {{70, 60, 62, 60, 80, 82}, 0}, // Masquerain
+  [313] = {{130, 70, 35, 60, 70, 35}, 2}, // Wailmer
+  [314] = {{170, 90, 45, 60, 90, 45}, 2}, // Wailord
+  [315] = {{50, 45, 45, 50, 35, 35}, 4}, // Skitty
+  [316] = {{70, 65, 65, 70, 55, 55}, 4}, // Delcatty
+  [317] = {{60, 90, 70, 40, 60, 120}, 3}, // Kecleon
+  [318] = {{40, 40, 55, 55, 40, 70}, 0}, // Baltoy
+  [319] = {{60, 70, 105, 75, 70, 120}, 0}, // Claydol
+  [320] = {{30, 45, 135, 30, 45, 90}, 0}, // Nosepass
+  [321] = {{70, 85, 140, 20, 85, 70}, 0}, // Torkoal
+  [322] = {{50, 75, 75, 50, 65, 65}, 3}, // Sableye
+  [323] = {{50, 48, 43, 60, 46, 41}, 0}, // Barboach
+  [324] = {{110, 78, 73, 60, 76, 71}, 0}, // Whiscash
+  [325] = {{43, 30, 55, 97, 40, 65}, 4}, // Luvdisc
+  [326] = {{43, 80, 65, 35, 50, 35}, 2}, // Corphish
+  [327] = {{63, 120, 85, 55, 90, 55}, 2}, // Crawdaunt
+  [328] = {{20, 15, 20, 80, 10, 55}, 1}, // Feebas
+  [329] = {{95, 60, 79, 81, 100, 125}, 1}, // Milotic
+  [330] = {{45, 90, 20, 65, 65, 20}, 5}, // Carvanha
+  [331] = {{70, 120, 40, 95, 95, 40}, 5}, // Sharpedo
+  [332] = {{45, 100, 45, 10, 45, 45}, 3}, // Trapinch
+  [333] = {{50, 70, 50, 70, 50, 50}, 3}, // Vibrava
+  [334] = {{80, 100, 80, 100, 80, 80}, 3}, // Flygon
+  [335] = {{72, 60, 30, 25, 20, 30}, 2}, // Makuhita
+  [336] = {{144, 120, 60, 50, 40, 60}, 2}, // Hariyama
+  [337] = {{40, 45, 40, 65, 65, 40}, 5}, // Electrike
+  [338] = {{70, 75, 60, 105, 105, 60}, 5}, // Manectric
+  [339] = {{60, 60, 40, 35, 65, 45}, 0}, // Numel
+  [340] = {{70, 100, 70, 40, 105, 75}, 0}, // Camerupt
+  [341] = {{70, 40, 50, 25, 55, 50}, 3}, // Spheal
+  [342] = {{90, 60, 70, 45, 75, 70}, 3}, // Sealeo
+  [343] = {{110, 80, 90, 65, 95, 90}, 3}, // Walrein
+  [344] = {{50, 85, 40, 35, 85, 40}, 3}, // Cacnea
+  [345] = {{70, 115, 60, 55, 115, 60}, 3}, // Cacturne
+  [346] = {{50, 50, 50, 50, 50, 50}, 0}, // Snorunt
+  [347] = {{80, 80, 80, 80, 80, 80}, 0}, // Glalie
+  [348] = {{70, 55, 65, 70, 95, 85}, 4}, // Lunatone
+  [349] = {{70, 95, 85, 70, 55, 65}, 4}, // Solrock
+  [350] = {{50, 20, 40, 20, 20, 40}, 4}, // Azurill
+  [351] = {{60, 25, 35, 60, 70, 80}, 4}, // Spoink
+  [352] = {{80, 45, 65, 80, 90, 110}, 4}, // Grumpig
+  [353] = {{60, 50, 40, 95, 85, 75}, 0}, // Plusle
+  [354] = {{60, 40, 50, 95, 75, 85}, 0}, // Minun
+  [355] = {{50, 85, 85, 50, 55, 55}, 4}, // Mawile
+  [356] = {{30, 40, 55, 60, 40, 55}, 0}, // Meditite
+  [357] = {{60, 60, 75, 80, 60, 75}, 0}, // Medicham
+  [358] = {{45, 40, 60, 50, 40, 75}, 1}, // Swablu
+  [359] = {{75, 70, 90, 80, 70, 105}, 1}, // Altaria
+  [360] = {{95, 23, 48, 23, 23, 48}, 0}, // Wynaut
+  [361] = {{20, 40, 90, 25, 30, 90}, 4}, // Duskull
+  [362] = {{40, 70, 130, 25, 60, 130}, 4}, // Dusclops
+  [363] = {{50, 60, 45, 65, 100, 80}, 3}, // Roselia
+  [364] = {{60, 60, 60, 30, 35, 35}, 5}, // Slakoth
+  [365] = {{80, 80, 80, 90, 55, 55}, 5}, // Vigoroth
+  [366] = {{150, 160, 100, 100, 95, 65}, 5}, // Slaking
+  [367] = {{70, 43, 53, 40, 43, 53}, 2}, // Gulpin
+  [368] = {{100, 73, 83, 55, 73, 83}, 2}, // Swalot
+  [369] = {{99, 68, 83, 51, 72, 87}, 5}, // Tropius
+  [370] = {{64, 51, 23, 28, 51, 23}, 3}, // Whismur
+  [371] = {{84, 71, 43, 48, 71, 43}, 3}, // Loudred
+  [372] = {{104, 91, 63, 68, 91, 63}, 3}, // Exploud
+  [373] = {{35, 64, 85, 32, 74, 55}, 1}, // Clamperl
+  [374] = {{55, 104, 105, 52, 94, 75}, 1}, // Huntail
+  [375] = {{55, 84, 105, 52, 114, 75}, 1}, // Gorebyss
+  [376] = {{65, 130, 60, 75, 75, 60}, 3}, // Absol
+  [377] = {{44, 75, 35, 45, 63, 33}, 4}, // Shuppet
+  [378] = {{64, 115, 65, 65, 83, 63}, 4}, // Banette
+  [379] = {{73, 100, 60, 65, 100, 60}, 2}, // Seviper
+  [380] = {{73, 115, 60, 90, 60, 60}, 1}, // Zangoose
+  [381] = {{100, 90, 130, 55, 45, 65}, 5}, // Relicanth
+  [382] = {{50, 70, 100, 30, 40, 40}, 5}, // Aron
+  [383] = {{60, 90, 140, 40, 50, 50}, 5}, // Lairon
+  [384] = {{70, 110, 180, 50, 60, 60}, 5}, // Aggron
+  [385] = {{70, 70, 70, 70, 70, 70}, 0}, // Castform
+  [386] = {{65, 73, 55, 85, 47, 75}, 1}, // Volbeat
+  [387] = {{65, 47, 55, 85, 73, 75}, 2}, // Illumise
+  [388] = {{66, 41, 77, 23, 61, 87}, 1}, // Lileep
+  [389] = {{86, 81, 97, 43, 81, 107}, 1}, // Cradily
+  [390] = {{45, 95, 50, 75, 40, 50}, 1}, // Anorith
+  [391] = {{75, 125, 100, 45, 70, 80}, 1}, // Armaldo
+  [392] = {{28, 25, 25, 40, 45, 35}, 5}, // Ralts
+  [393] = {{38, 35, 35, 50, 65, 55}, 5}, // Kirlia
+  [394] = {{68, 65, 65, 80, 125, 115}, 5}, // Gardevoir
+  [395] = {{45, 75, 60, 50, 40, 30}, 5}, // Bagon
+  [396] = {{65, 95, 100, 50, 60, 50}, 5}, // Shelgon
+  [397] = {{95, 135, 80, 100, 110, 80}, 5}, // Salamence
+  [398] = {{40, 55, 80, 30, 35, 60}, 5}, // Beldum
+  [399] = {{60, 75, 100, 50, 55, 80}, 5}, // Metang
+  [400] = {{80, 135, 130, 70, 95, 90}, 5}, // Metagross
+  [401] = {{80, 100, 200, 50, 50, 100}, 5}, // Regirock
+  [402] = {{80, 50, 100, 50, 100, 200}, 5}, // Regice
+  [403] = {{80, 75, 150, 50, 75, 150}, 5}, // Registeel
+  [404] = {{100, 100, 90, 90, 150, 140}, 5}, // Kyogre
+  [405] = {{100, 150, 140, 90, 100, 90}, 5}, // Groudon
+  [406] = {{105, 150, 90, 95, 150, 90}, 5}, // Rayquaza
+  [407] = {{80, 80, 90, 110, 110, 130}, 5}, // Latias
+  [408] = {{80, 90, 80, 110, 130, 110}, 5}, // Latios
+  [409] = {{100, 100, 100, 100, 100, 100}, 5}, // Jirachi
+  [410] = {{50, 150, 50, 150, 150, 50}, 5}, // Deoxys
+  [411] = {{65, 50, 70, 65, 95, 80}, 4}, // Chimecho
+  [412] = {{0, 0, 0, 0, 0, 0}, 0}, // Egg
+};
+
+const uint8_t move_pp[MOVES_COUNT] = {
+  0, 35, 25, 10, 15, 20, 20, 15, 15, 15, 35, 30, 5, 10, 30, 30, 35, 35, 20, 15,
+  20, 20, 10, 20, 30, 5, 25, 15, 15, 15, 25, 20, 5, 35, 15, 20, 20, 20, 15, 30,
+  35, 20, 20, 30, 25, 40, 20, 15, 20, 20, 20, 30, 25, 15, 30, 25, 5, 15, 10, 5,
+  20, 20, 20, 5, 35, 20, 25, 20, 20, 20, 15, 20, 10, 10, 40, 25, 10, 35, 30, 15,
+  20, 40, 10, 15, 30, 15, 20, 10, 15, 10, 5, 10, 10, 25, 10, 20, 40, 30, 30, 20,
+  20, 15, 10, 40, 15, 20, 30, 20, 20, 10, 40, 40, 30, 30, 30, 20, 30, 10, 10, 20,
+  5, 10, 30, 20, 20, 20, 5, 15, 10, 20, 15, 15, 35, 20, 15, 10, 20, 30, 15, 40,
+  20, 15, 10, 5, 10, 30, 10, 15, 20, 15, 40, 40, 10, 5, 15, 10, 10, 10, 15, 30,
+  30, 10, 10, 20, 10, 1, 1, 10, 10, 10, 5, 15, 25, 15, 10, 15, 30, 5, 40, 15,
+  10, 25, 10, 30, 10, 20, 10, 10, 10, 10, 10, 20, 5, 40, 5, 5, 15, 5, 10, 5,
+  15, 10, 5, 10, 20, 20, 40, 15, 10, 20, 20, 25, 5, 15, 10, 5, 20, 15, 20, 25,
+  20, 5, 30, 5, 10, 20, 40, 5, 20, 40, 20, 15, 35, 10, 5, 5, 5, 15, 5, 20,
+  5, 5, 15, 20, 10, 5, 5, 15, 15, 15, 15, 10, 10, 10, 20, 10, 10, 10, 10, 15,
+  15, 15, 10, 20, 20, 10, 20, 20, 20, 20, 20, 10, 10, 10, 20, 20, 5, 15, 10, 10,
+  15, 10, 20, 5, 5, 10, 10, 20, 5, 10, 20, 10, 20, 20, 20, 5, 5, 15, 20, 10,
+  15, 20, 15, 10, 10, 15, 10, 5, 5, 10, 15, 10, 5, 20, 25, 5, 40, 10, 5, 40,
+  15, 20, 20, 5, 15, 20, 30, 15, 15, 5, 10, 30, 20, 30, 15, 5, 40, 15, 5, 20,
+  5, 15, 25, 40, 15, 20, 15, 20, 15, 20, 10, 20, 20, 5, 5,
+};
+
+const uint32_t experience_table[GROWTH_RATES][MAX_LEVEL + 1] = {
+  { // medium-fast
+    0, 0, 8, 27, 64, 125, 216, 343, 512, 729,
+    1000, 1331, 1728, 2197, 2744, 3375, 4096, 4913, 5832, 6859,
+    8000, 9261, 10648, 12167, 13824, 15625, 17576, 19683, 21952, 24389,
+    27000, 29791, 32768, 35937, 39304, 42875, 46656, 50653, 54872, 59319,
+    64000, 68921, 74088, 79507, 85184, 91125, 97336, 103823, 110592, 117649,
+    125000, 132651, 140608, 148877, 157464, 166375, 175616, 185193, 195112, 205379,
+    216000, 226981, 238328, 250047, 262144, 274625, 287496, 300763, 314432, 328509,
+    343000, 357911, 373248, 389017, 405224, 421875, 438976, 456533, 474552, 493039,
+    512000, 531441, 551368, 571787, 592704, 614125, 636056, 658503, 681472, 704969,
+    729000, 753571, 778688, 804357, 830584, 857375, 884736, 912673, 941192, 970299,
+    1000000,
+  },
+  { // erratic
+    0, 0, 15, 52, 122, 237, 406, 637, 942, 1326,
+    1800, 2369, 3041, 3822, 4719, 5737, 6881, 8155, 9564, 11111,
+    12800, 14632, 16610, 18737, 21012, 23437, 26012, 28737, 31610, 34632,
+    37800, 41111, 44564, 48155, 51881, 55737, 59719, 63822, 68041, 72369,
+    76800, 81326, 85942, 90637, 95406, 100237, 105122, 110052, 115015, 120001,
+    125000, 131324, 137795, 144410, 151165, 158056, 165079, 172229, 179503, 186894,
+    194400, 202013, 209728, 217540, 225443, 233431, 241496, 249633, 257834, 267406,
+    276458, 286328, 296358, 305767, 316074, 326531, 336255, 346965, 357812, 367807,
+    378880, 390077, 400293, 411686, 423190, 433572, 445239, 457001, 467489, 479378,
+    491346, 501878, 513934, 526049, 536557, 548720, 560922, 571333, 583539, 591882,
+    600000,
+  },
+  { // fluctuating
+    0, 0, 4, 13, 32, 65, 112, 178, 276, 393,
+    540, 745, 967, 1230, 1591, 1957, 2457, 3046, 3732, 4526,
+    5440, 6482, 7666, 9003, 10506, 12187, 14060, 16140, 18439, 20974,
+    23760, 26811, 30146, 33780, 37731, 42017, 46656, 50653, 55969, 60505,
+    66560, 71677, 78533, 84277, 91998, 98415, 107069, 114205, 123863, 131766,
+    142500, 151222, 163105, 172697, 185807, 196322, 210739, 222231, 238036, 250562,
+    267840, 281456, 300293, 315059, 335544, 351520, 373744, 390991, 415050, 433631,
+    459620, 479600, 507617, 529063, 559209, 582187, 614566, 639146, 673863, 700115,
+    737280, 765275, 804997, 834809, 877201, 908905, 954084, 987754, 1035837, 1071552,
+    1122660, 1160499, 1214753, 1254796, 1312322, 1354652, 1415577, 1460276, 1524731, 1571884,
+    1640000,
+  },
+  { // medium-slow
+    0, 0, 9, 57, 96, 135, 179, 236, 314, 419,
+    560, 742, 973, 1261, 1612, 2035, 2535, 3120, 3798, 4575,
+    5460, 6458, 7577, 8825, 10208, 11735, 13411, 15244, 17242, 19411,
+    21760, 24294, 27021, 29949, 33084, 36435, 40007, 43808, 47846, 52127,
+    56660, 61450, 66505, 71833, 77440, 83335, 89523, 96012, 102810, 109923,
+    117360, 125126, 133229, 141677, 150476, 159635, 169159, 179056, 189334, 199999,
+    211060, 222522, 234393, 246681, 259392, 272535, 286115, 300140, 314618, 329555,
+    344960, 360838, 377197, 394045, 411388, 429235, 447591, 466464, 485862, 505791,
+    526260, 547274, 568841, 590969, 613664, 636935, 660787, 685228, 710266, 735907,
+    762160, 789030, 816525, 844653, 873420, 902835, 932903, 963632, 995030, 1027103,
+    1059860,
+  },
+  { // fast
+    0, 0, 6, 21, 51, 100, 172, 274, 409, 583,
+    800, 1064, 1382, 1757, 2195, 2700, 3276, 3930, 4665, 5487,
+    6400, 7408, 8518, 9733, 11059, 12500, 14060, 15746, 17561, 19511,
+    21600, 23832, 26214, 28749, 31443, 34300, 37324, 40522, 43897, 47455,
+    51200, 55136, 59270, 63605, 68147, 72900, 77868, 83058, 88473, 94119,
+    100000, 106120, 112486, 119101, 125971, 133100, 140492, 148154, 156089, 164303,
+    172800, 181584, 190662, 200037, 209715, 219700, 229996, 240610, 251545, 262807,
+    274400, 286328, 298598, 311213, 324179, 337500, 351180, 365226, 379641, 394431,
+    409600, 425152, 441094, 457429, 474163, 491300, 508844, 526802, 545177, 563975,
+    583200, 602856, 622950, 643485, 664467, 685900, 707788, 730138, 752953, 776239,
+    800000,
+  },
+  { // slow
+    0, 0, 10, 33, 80, 156, 270, 428, 640, 911,
+    1250, 1663, 2160, 2746, 3430, 4218, 5120, 6141, 7290, 8573,
+    10000, 11576, 13310, 15208, 17280, 19531, 21970, 24603, 27440, 30486,
+    33750, 37238, 40960, 44921, 49130, 53593, 58320, 63316, 68590, 74148,
+    80000, 86151, 92610, 99383, 106480, 113906, 121670, 129778, 138240, 147061,
+    156250, 165813, 175760, 186096, 196830, 207968, 219520, 231491, 243890, 256723,
+    270000, 283726, 297910, 312558, 327680, 343281, 359370, 375953, 393040, 410636,
+    428750, 447388, 466560, 486271, 506530, 527343, 548720, 570666, 593190, 616298,
+    640000, 664301, 689210, 714733, 740880, 767656, 795070, 823128, 851840, 881211,
+    911250, 941963, 973360, 1005446, 1038230, 1071718, 1105920, 1140841, 1176490, 1212873,
+    1250000,
+  },
+};
+
+const uint32_t legal_species[BITSET_WORDS(SPECIES_COUNT)] = {
+  0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+  0xffffffff, 0x0fffffff, 0xffe00000, 0xffffffff, 0xffffffff, 0xffffffff,
+  0x0fffffff,
+};
+const uint32_t legal_items[BITSET_WORDS(ITEMS_COUNT)] = {
+  0xffffffff, 0x800fffff, 0xe07bfeff, 0xfe00fd87, 0xffffffff, 0xfff8ffff,
+  0xffffffff, 0xc0000003, 0xfffff7ff, 0xffffffff, 0xe7ffffff, 0x01ffffff,
+};
+
+const uint32_t learnsets_known[BITSET_WORDS(SPECIES_COUNT)] = {
+  0x00006c00, 0x00000000, 0x00000000, 0x00000000, 0x00000012, 0x00000000,
+  0x00000200, 0x00000000, 0x00000000, 0x0000002c, 0x00000000, 0x00000000,
+  0x00004000,
+};
+
+const uint32_t learnsets[SPECIES_COUNT][BITSET_WORDS(MOVES_COUNT)] = {
+  [1] = { // Bulbasaur
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [2] = { // Ivysaur
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [3] = { // Venusaur
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [4] = { // Charmander
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [5] = { // Charmeleon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [6] = { // Charizard
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [7] = { // Squirtle
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [8] = { // Wartortle
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [9] = { // Blastoise
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [10] = { // Caterpie
+    0x00000000, 0x00000002, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [11] = { // Metapod
+    0x00000000, 0x00000002, 0x00020000, 0x00000400, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [12] = { // Butterfree
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [13] = { // Weedle
+    0x00000000, 0x00000100, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [14] = { // Kakuna
+    0x00000000, 0x00000100, 0x00020000, 0x00000400, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [15] = { // Beedrill
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [16] = { // Pidgey
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [17] = { // Pidgeotto
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [18] = { // Pidgeot
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [19] = { // Rattata
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [20] = { // Raticate
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [21] = { // Spearow
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [22] = { // Fearow
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [23] = { // Ekans
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [24] = { // Arbok
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [25] = { // Pikachu
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [26] = { // Raichu
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [27] = { // Sandshrew
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [28] = { // Sandslash
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [29] = { // Nidoran♀
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [30] = { // Nidorina
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [31] = { // Nidoqueen
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [32] = { // Nidoran♂
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [33] = { // Nidorino
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [34] = { // Nidoking
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [35] = { // Clefairy
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [36] = { // Clefable
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [37] = { // Vulpix
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [38] = { // Ninetales
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [39] = { // Jigglypuff
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [40] = { // Wigglytuff
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [41] = { // Zubat
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [42] = { // Golbat
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [43] = { // Oddish
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [44] = { // Gloom
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [45] = { // Vileplume
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [46] = { // Paras
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [47] = { // Parasect
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [48] = { // Venonat
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [49] = { // Venomoth
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [50] = { // Diglett
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [51] = { // Dugtrio
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [52] = { // Meowth
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [53] = { // Persian
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [54] = { // Psyduck
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [55] = { // Golduck
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [56] = { // Mankey
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [57] = { // Primeape
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [58] = { // Growlithe
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [59] = { // Arcanine
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [60] = { // Poliwag
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [61] = { // Poliwhirl
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [62] = { // Poliwrath
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [63] = { // Abra
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [64] = { // Kadabra
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [65] = { // Alakazam
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [66] = { // Machop
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [67] = { // Machoke
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [68] = { // Machamp
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [69] = { // Bellsprout
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [70] = { // Weepinbell
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [71] = { // Victreebel
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [72] = { // Tentacool
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [73] = { // Tentacruel
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [74] = { // Geodude
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [75] = { // Graveler
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [76] = { // Golem
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [77] = { // Ponyta
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [78] = { // Rapidash
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [79] = { // Slowpoke
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [80] = { // Slowbro
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [81] = { // Magnemite
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [82] = { // Magneton
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [83] = { // Farfetch'd
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [84] = { // Doduo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [85] = { // Dodrio
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [86] = { // Seel
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [87] = { // Dewgong
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [88] = { // Grimer
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [89] = { // Muk
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [90] = { // Shellder
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [91] = { // Cloyster
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [92] = { // Gastly
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [93] = { // Haunter
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [94] = { // Gengar
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [95] = { // Onix
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [96] = { // Drowzee
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [97] = { // Hypno
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [98] = { // Krabby
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [99] = { // Kingler
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [100] = { // Voltorb
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [101] = { // Electrode
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [102] = { // Exeggcute
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [103] = { // Exeggutor
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [104] = { // Cubone
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [105] = { // Marowak
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [106] = { // Hitmonlee
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [107] = { // Hitmonchan
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [108] = { // Lickitung
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [109] = { // Koffing
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [110] = { // Weezing
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [111] = { // Rhyhorn
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [112] = { // Rhydon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [113] = { // Chansey
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [114] = { // Tangela
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [115] = { // Kangaskhan
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [116] = { // Horsea
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [117] = { // Seadra
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [118] = { // Goldeen
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [119] = { // Seaking
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [120] = { // Staryu
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [121] = { // Starmie
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [122] = { // Mr. Mime
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [123] = { // Scyther
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [124] = { // Jynx
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [125] = { // Electabuzz
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [126] = { // Magmar
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [127] = { // Pinsir
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [128] = { // Tauros
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [129] = { // Magikarp
+    0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00400000, 0x00008000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [130] = { // Gyarados
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [131] = { // Lapras
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [132] = { // Ditto
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [133] = { // Eevee
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [134] = { // Vaporeon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [135] = { // Jolteon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [136] = { // Flareon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [137] = { // Porygon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [138] = { // Omanyte
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [139] = { // Omastar
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [140] = { // Kabuto
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [141] = { // Kabutops
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [142] = { // Aerodactyl
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [143] = { // Snorlax
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [144] = { // Articuno
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [145] = { // Zapdos
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [146] = { // Moltres
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [147] = { // Dratini
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [148] = { // Dragonair
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [149] = { // Dragonite
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [150] = { // Mewtwo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [151] = { // Mew
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [152] = { // Chikorita
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [153] = { // Bayleef
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [154] = { // Meganium
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [155] = { // Cyndaquil
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [156] = { // Quilava
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [157] = { // Typhlosion
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [158] = { // Totodile
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [159] = { // Croconaw
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [160] = { // Feraligatr
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [161] = { // Sentret
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [162] = { // Furret
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [163] = { // Hoothoot
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [164] = { // Noctowl
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [165] = { // Ledyba
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [166] = { // Ledian
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [167] = { // Spinarak
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [168] = { // Ariados
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [169] = { // Crobat
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [170] = { // Chinchou
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [171] = { // Lanturn
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [172] = { // Pichu
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [173] = { // Cleffa
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [174] = { // Igglybuff
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [175] = { // Togepi
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [176] = { // Togetic
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [177] = { // Natu
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [178] = { // Xatu
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [179] = { // Mareep
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [180] = { // Flaaffy
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [181] = { // Ampharos
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [182] = { // Bellossom
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [183] = { // Marill
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [184] = { // Azumarill
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [185] = { // Sudowoodo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [186] = { // Politoed
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [187] = { // Hoppip
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [188] = { // Skiploom
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [189] = { // Jumpluff
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [190] = { // Aipom
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [191] = { // Sunkern
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [192] = { // Sunflora
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [193] = { // Yanma
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [194] = { // Wooper
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [195] = { // Quagsire
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [196] = { // Espeon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [197] = { // Umbreon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [198] = { // Murkrow
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [199] = { // Slowking
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [200] = { // Misdreavus
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [201] = { // Unown
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [202] = { // Wobbuffet
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [203] = { // Girafarig
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [204] = { // Pineco
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [205] = { // Forretress
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [206] = { // Dunsparce
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [207] = { // Gligar
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [208] = { // Steelix
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [209] = { // Snubbull
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [210] = { // Granbull
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [211] = { // Qwilfish
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [212] = { // Scizor
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [213] = { // Shuckle
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [214] = { // Heracross
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [215] = { // Sneasel
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [216] = { // Teddiursa
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [217] = { // Ursaring
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [218] = { // Slugma
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [219] = { // Magcargo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [220] = { // Swinub
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [221] = { // Piloswine
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [222] = { // Corsola
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [223] = { // Remoraid
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [224] = { // Octillery
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [225] = { // Delibird
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [226] = { // Mantine
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [227] = { // Skarmory
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [228] = { // Houndour
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [229] = { // Houndoom
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [230] = { // Kingdra
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [231] = { // Phanpy
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [232] = { // Donphan
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [233] = { // Porygon2
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [234] = { // Stantler
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [235] = { // Smeargle
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [236] = { // Tyrogue
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [237] = { // Hitmontop
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [238] = { // Smoochum
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [239] = { // Elekid
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [240] = { // Magby
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [241] = { // Miltank
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [242] = { // Blissey
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [243] = { // Raikou
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [244] = { // Entei
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [245] = { // Suicune
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [246] = { // Larvitar
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [247] = { // Pupitar
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [248] = { // Tyranitar
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [249] = { // Lugia
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [250] = { // Ho-Oh
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [251] = { // Celebi
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [277] = { // Treecko
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [278] = { // Grovyle
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [279] = { // Sceptile
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [280] = { // Torchic
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [281] = { // Combusken
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [282] = { // Blaziken
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [283] = { // Mudkip
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [284] = { // Marshtomp
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [285] = { // Swampert
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [286] = { // Poochyena
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [287] = { // Mightyena
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [288] = { // Zigzagoon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [289] = { // Linoone
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [290] = { // Wurmple
+    0x00000000, 0x00000102, 0x00020000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [291] = { // Silcoon
+    0x00000000, 0x00000102, 0x00020000, 0x00000400, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [292] = { // Beautifly
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [293] = { // Cascoon
+    0x00000000, 0x00000102, 0x00020000, 0x00000400, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [294] = { // Dustox
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [295] = { // Lotad
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [296] = { // Lombre
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [297] = { // Ludicolo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [298] = { // Seedot
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [299] = { // Nuzleaf
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [300] = { // Shiftry
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [301] = { // Nincada
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [302] = { // Ninjask
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [303] = { // Shedinja
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [304] = { // Taillow
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [305] = { // Swellow
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [306] = { // Shroomish
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [307] = { // Breloom
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [308] = { // Spinda
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [309] = { // Wingull
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [310] = { // Pelipper
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [311] = { // Surskit
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [312] = { // Masquerain
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [313] = { // Wailmer
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [314] = { // Wailord
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [315] = { // Skitty
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [316] = { // Delcatty
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [317] = { // Kecleon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [318] = { // Baltoy
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [319] = { // Claydol
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [320] = { // Nosepass
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [321] = { // Torkoal
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [322] = { // Sableye
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [323] = { // Barboach
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [324] = { // Whiscash
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [325] = { // Luvdisc
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [326] = { // Corphish
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [327] = { // Crawdaunt
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [328] = { // Feebas
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [329] = { // Milotic
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [330] = { // Carvanha
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [331] = { // Sharpedo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [332] = { // Trapinch
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [333] = { // Vibrava
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [334] = { // Flygon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [335] = { // Makuhita
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [336] = { // Hariyama
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [337] = { // Electrike
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [338] = { // Manectric
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [339] = { // Numel
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [340] = { // Camerupt
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [341] = { // Spheal
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [342] = { // Sealeo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [343] = { // Walrein
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [344] = { // Cacnea
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [345] = { // Cacturne
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [346] = { // Snorunt
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [347] = { // Glalie
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [348] = { // Lunatone
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [349] = { // Solrock
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [350] = { // Azurill
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [351] = { // Spoink
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [352] = { // Grumpig
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [353] = { // Plusle
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [354] = { // Minun
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [355] = { // Mawile
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [356] = { // Meditite
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [357] = { // Medicham
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [358] = { // Swablu
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [359] = { // Altaria
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [360] = { // Wynaut
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [361] = { // Duskull
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [362] = { // Dusclops
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [363] = { // Roselia
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [364] = { // Slakoth
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [365] = { // Vigoroth
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [366] = { // Slaking
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [367] = { // Gulpin
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [368] = { // Swalot
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [369] = { // Tropius
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [370] = { // Whismur
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [371] = { // Loudred
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [372] = { // Exploud
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [373] = { // Clamperl
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [374] = { // Huntail
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [375] = { // Gorebyss
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [376] = { // Absol
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [377] = { // Shuppet
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [378] = { // Banette
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [379] = { // Seviper
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [380] = { // Zangoose
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [381] = { // Relicanth
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [382] = { // Aron
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [383] = { // Lairon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [384] = { // Aggron
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [385] = { // Castform
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [386] = { // Volbeat
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [387] = { // Illumise
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [388] = { // Lileep
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [389] = { // Cradily
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [390] = { // Anorith
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [391] = { // Armaldo
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [392] = { // Ralts
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [393] = { // Kirlia
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [394] = { // Gardevoir
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [395] = { // Bagon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [396] = { // Shelgon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [397] = { // Salamence
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [398] = { // Beldum
+    0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  },
+  [399] = { // Metang
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [400] = { // Metagross
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [401] = { // Regirock
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [402] = { // Regice
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [403] = { // Registeel
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [404] = { // Kyogre
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [405] = { // Groudon
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [406] = { // Rayquaza
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [407] = { // Latias
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [408] = { // Latios
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [409] = { // Jirachi
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [410] = { // Deoxys
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [411] = { // Chimecho
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+  [412] = { // Egg
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000007,
+  },
+};
+
+const struct GameRules game_rules[GAMES] = {
+  [0] = { // colosseum-bonus
+    .locations = {
+      0x00000000, 0x00000000, 0x00000000, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000, 0xc0000000,
+    },
+    .balls = 0x0010
+  },
+  [1] = { // sapphire
+    .locations = {
+      0xffffffff, 0xffffffff, 0x007fffff, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000, 0xc0000000,
+    },
+    .balls = 0x1ffe
+  },
+  [2] = { // ruby
+    .locations = {
+      0xffffffff, 0xffffffff, 0x007fffff, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000, 0xc0000000,
+    },
+    .balls = 0x1ffe
+  },
+  [3] = { // emerald
+    .locations = {
+      0xffffffff, 0xffffffff, 0x007fffff, 0x00000000,
+      0x00000000, 0x00000000, 0x001fffe0, 0xc0000000,
+    },
+    .balls = 0x1ffe
+  },
+  [4] = { // firered
+    .locations = {
+      0x00000000, 0x00000000, 0xff000000, 0xffffffff,
+      0xffffffff, 0xffffffff, 0x0000001f, 0xc0000000,
+    },
+    .balls = 0x1ffe
+  },
+  [5] = { // leafgreen
+    .locations = {
+      0x00000000, 0x00000000, 0xff000000, 0xffffffff,
+      0xffffffff, 0xffffffff, 0x0000001f, 0xc0000000,
+    },
+    .balls = 0x1ffe
+  },
+  [15] = { // colosseum-xd
+    .locations = {
+      0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+      0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    },
+    .balls = 0x1fde
+  },
+};
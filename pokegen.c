@@ -0,0 +1,3543 @@
+/* Generation 3 Pokémon Data Structure Generator
+ * Copyright © 2017 Ethan Welker (nuew)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HAVE_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+#include "pokegen.h"
+
+/* Errors
+ * A function that fails returns false (or NULL, or 0), and leaves a message
+ * saying why for pokegen_error(); nothing is printed. Each thread has its own. */
+static _Thread_local char error_text[256];
+
+// The reason the calling thread's last failed call failed
+const char *pokegen_error(void) {
+  return error_text;
+}
+
+// Set the calling thread's error message
+__attribute__((format(printf, 1, 2)))
+static void complain(const char *format, ...) {
+  va_list args;
+
+  va_start(args, format);
+  vsnprintf(error_text, sizeof(error_text), format, args);
+  va_end(args);
+}
+
+// Little-endian loads and stores, the games' byte order
+static uint16_t load16(const uint8_t *p) {
+  return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+static uint32_t load32(const uint8_t *p) {
+  return (uint32_t) p[0] | ((uint32_t) p[1] << 8) |
+         ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static void store16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t) v;
+  p[1] = (uint8_t) (v >> 8);
+}
+
+static void store32(uint8_t *p, uint32_t v) {
+  store16(p, (uint16_t) v);
+  store16(p + 2, (uint16_t) (v >> 16));
+}
+
+static uint64_t load64(const uint8_t *p) {
+  return (uint64_t) load32(p) | ((uint64_t) load32(p + 4) << 32);
+}
+
+static void store64(uint8_t *p, uint64_t v) {
+  store32(p, (uint32_t) v);
+  store32(p + 4, (uint32_t) (v >> 32));
+}
+
+// Byte offset within data of each datum, indexed by [order][DATUM_*]
+const uint8_t datum_offset[DATUM_ORDERS][DATUM_PER_DATA] = {
+  { 0, 12, 24, 36}, //  0 GAEM
+  { 0, 12, 36, 24}, //  1 GAME
+  { 0, 24, 12, 36}, //  2 GEAM
+  { 0, 36, 12, 24}, //  3 GEMA
+  { 0, 24, 36, 12}, //  4 GMAE
+  { 0, 36, 24, 12}, //  5 GMEA
+  {12,  0, 24, 36}, //  6 AGEM
+  {12,  0, 36, 24}, //  7 AGME
+  {24,  0, 12, 36}, //  8 AEGM
+  {36,  0, 12, 24}, //  9 AEMG
+  {24,  0, 36, 12}, // 10 AMGE
+  {36,  0, 24, 12}, // 11 AMEG
+  {12, 24,  0, 36}, // 12 EGAM
+  {12, 36,  0, 24}, // 13 EGMA
+  {24, 12,  0, 36}, // 14 EAGM
+  {36, 12,  0, 24}, // 15 EAMG
+  {24, 36,  0, 12}, // 16 EMGA
+  {36, 24,  0, 12}, // 17 EMAG
+  {12, 24, 36,  0}, // 18 MGAE
+  {12, 36, 24,  0}, // 19 MGEA
+  {24, 12, 36,  0}, // 20 MAGE
+  {36, 12, 24,  0}, // 21 MAEG
+  {24, 36, 12,  0}, // 22 MEGA
+  {36, 24, 12,  0}  // 23 MEAG
+};
+
+// Datum stored at each position within data, indexed by [order][position]
+const uint8_t datum_order[DATUM_ORDERS][DATUM_PER_DATA] = {
+  {0, 1, 2, 3}, //  0 GAEM
+  {0, 1, 3, 2}, //  1 GAME
+  {0, 2, 1, 3}, //  2 GEAM
+  {0, 2, 3, 1}, //  3 GEMA
+  {0, 3, 1, 2}, //  4 GMAE
+  {0, 3, 2, 1}, //  5 GMEA
+  {1, 0, 2, 3}, //  6 AGEM
+  {1, 0, 3, 2}, //  7 AGME
+  {1, 2, 0, 3}, //  8 AEGM
+  {1, 2, 3, 0}, //  9 AEMG
+  {1, 3, 0, 2}, // 10 AMGE
+  {1, 3, 2, 0}, // 11 AMEG
+  {2, 0, 1, 3}, // 12 EGAM
+  {2, 0, 3, 1}, // 13 EGMA
+  {2, 1, 0, 3}, // 14 EAGM
+  {2, 1, 3, 0}, // 15 EAMG
+  {2, 3, 0, 1}, // 16 EMGA
+  {2, 3, 1, 0}, // 17 EMAG
+  {3, 0, 1, 2}, // 18 MGAE
+  {3, 0, 2, 1}, // 19 MGEA
+  {3, 1, 0, 2}, // 20 MAGE
+  {3, 1, 2, 0}, // 21 MAEG
+  {3, 2, 0, 1}, // 22 MEGA
+  {3, 2, 1, 0}  // 23 MEAG
+};
+
+/* Substructure packing
+ * Each datum is packed field by field, little-endian and with narrow fields
+ * masked and shifted into place, straight into the caller's buffer. */
+static void growth_pack(uint8_t *dest, const struct Growth *growth) {
+  const struct PPBonus *bonus = &growth->pp_bonus;
+  const unsigned mask = FIELD_MASK(PP_BONUS_BITS);
+
+  store16(dest, growth->species);
+  store16(dest + 2, growth->held_item);
+  store32(dest + 4, growth->experience);
+  dest[8] = (uint8_t) ((bonus->move1 & mask) | ((bonus->move2 & mask) << 2) |
+                       ((bonus->move3 & mask) << 4) | ((bonus->move4 & mask) << 6));
+  dest[9] = growth->friendship;
+  store16(dest + 10, growth->unknown);
+}
+
+static void attacks_pack(uint8_t *dest, const struct Attacks *attacks) {
+  for(size_t i = 0; i < 4; i++) {
+    store16(dest + (2 * i), attacks->moves[i]);
+    dest[8 + i] = attacks->pp[i];
+  }
+}
+
+static void condition_pack(uint8_t *dest, const struct Condition *condition) {
+  dest[0] = condition->hp_ev;
+  dest[1] = condition->attack_ev;
+  dest[2] = condition->defense_ev;
+  dest[3] = condition->speed_ev;
+  dest[4] = condition->special_attack_ev;
+  dest[5] = condition->special_defense_ev;
+  dest[6] = condition->coolness;
+  dest[7] = condition->beauty;
+  dest[8] = condition->cuteness;
+  dest[9] = condition->smartness;
+  dest[10] = condition->toughness;
+  dest[11] = condition->feel;
+}
+
+static void misc_pack(uint8_t *dest, const struct Misc *misc) {
+  const struct Origins *origins = &misc->origins;
+  const struct IVs *ivs = &misc->ivs;
+  const uint32_t iv = FIELD_MASK(IV_BITS);
+
+  dest[0] = (uint8_t) ((misc->pokerus.days_remaining & FIELD_MASK(POKERUS_BITS)) |
+                       ((misc->pokerus.strain & FIELD_MASK(POKERUS_BITS)) << 4));
+  dest[1] = misc->met_location;
+  store16(dest + 2, (uint16_t) ((origins->level_met & FIELD_MASK(LEVEL_MET_BITS)) |
+                                ((origins->game_met & FIELD_MASK(GAME_MET_BITS)) << 7) |
+                                ((origins->pokeball_type & FIELD_MASK(POKEBALL_TYPE_BITS)) << 11) |
+                                ((origins->trainer_gender & 1U) << 15)));
+  store32(dest + 4, (ivs->hp & iv) | ((ivs->attack & iv) << 5) | ((ivs->defense & iv) << 10) |
+                    ((ivs->speed & iv) << 15) | ((ivs->special_attack & iv) << 20) |
+                    ((ivs->special_defense & iv) << 25) | ((ivs->egg & 1U) << 30) |
+                    ((uint32_t) (ivs->ability & 1U) << 31));
+  store32(dest + 8, misc->ribbons);
+}
+
+static void growth_unpack(struct Growth *growth, const uint8_t *src) {
+  growth->species = load16(src);
+  growth->held_item = load16(src + 2);
+  growth->experience = load32(src + 4);
+  growth->pp_bonus = (struct PPBonus) {
+    .move1 = src[8] & 3,
+    .move2 = (src[8] >> 2) & 3,
+    .move3 = (src[8] >> 4) & 3,
+    .move4 = src[8] >> 6
+  };
+  growth->friendship = src[9];
+  growth->unknown = load16(src + 10);
+}
+
+static void attacks_unpack(struct Attacks *attacks, const uint8_t *src) {
+  for(size_t i = 0; i < 4; i++) {
+    attacks->moves[i] = load16(src + (2 * i));
+    attacks->pp[i] = src[8 + i];
+  }
+}
+
+static void condition_unpack(struct Condition *condition, const uint8_t *src) {
+  *condition = (struct Condition) {
+    .hp_ev = src[0],
+    .attack_ev = src[1],
+    .defense_ev = src[2],
+    .speed_ev = src[3],
+    .special_attack_ev = src[4],
+    .special_defense_ev = src[5],
+    .coolness = src[6],
+    .beauty = src[7],
+    .cuteness = src[8],
+    .smartness = src[9],
+    .toughness = src[10],
+    .feel = src[11]
+  };
+}
+
+static void misc_unpack(struct Misc *misc, const uint8_t *src) {
+  uint16_t origins = load16(src + 2);
+  uint32_t ivs = load32(src + 4);
+
+  misc->pokerus = (struct Pokerus) {
+    .days_remaining = src[0] & 0xf,
+    .strain = src[0] >> 4
+  };
+  misc->met_location = src[1];
+  misc->origins = (struct Origins) {
+    .level_met = origins & FIELD_MASK(LEVEL_MET_BITS),
+    .game_met = (origins >> 7) & FIELD_MASK(GAME_MET_BITS),
+    .pokeball_type = (origins >> 11) & FIELD_MASK(POKEBALL_TYPE_BITS),
+    .trainer_gender = origins >> 15
+  };
+  misc->ivs = (struct IVs) {
+    .hp = ivs & FIELD_MASK(IV_BITS),
+    .attack = (ivs >> 5) & FIELD_MASK(IV_BITS),
+    .defense = (ivs >> 10) & FIELD_MASK(IV_BITS),
+    .speed = (ivs >> 15) & FIELD_MASK(IV_BITS),
+    .special_attack = (ivs >> 20) & FIELD_MASK(IV_BITS),
+    .special_defense = (ivs >> 25) & FIELD_MASK(IV_BITS),
+    .egg = (ivs >> 30) & 1,
+    .ability = ivs >> 31
+  };
+  misc->ribbons = load32(src + 8);
+}
+
+// Pack the pokémon structures, unencrypted, in the order personality selects
+static void data_assemble_to(
+  void *dest,
+  uint32_t personality,
+  const struct Growth *growth,
+  const struct Attacks *attacks,
+  const struct Condition *condition,
+  const struct Misc *misc
+) {
+  uint8_t *_dest = (uint8_t *) dest;
+  const uint8_t *offset = datum_offset[personality % DATUM_ORDERS];
+
+  growth_pack(_dest + offset[DATUM_GROWTH], growth);
+  attacks_pack(_dest + offset[DATUM_ATTACKS], attacks);
+  condition_pack(_dest + offset[DATUM_CONDITION], condition);
+  misc_pack(_dest + offset[DATUM_MISC], misc);
+}
+
+// Checksum of len bytes of assembled data: the sum of its little-endian halfwords
+static uint16_t data_checksum(const uint8_t *data, size_t len) {
+  uint16_t cksum = 0;
+  for(size_t i = 0; i < len; i += sizeof(uint16_t)) {
+    cksum += load16(data + i);
+  }
+  return cksum;
+}
+
+// Encrypt or decrypt len bytes of data in place, as little-endian words xored
+// with key
+static void data_crypt(uint8_t *data, size_t len, uint32_t key) {
+  for(size_t i = 0; i < len; i += sizeof(uint32_t)) {
+    store32(data + i, load32(data + i) ^ key);
+  }
+}
+
+// Decrypt data, and unpack it back into the pokémon structures
+// returns false if the decrypted data doesn't match checksum
+static bool data_decrypt_from(
+  const void *src,
+  uint32_t personality,
+  uint32_t trainer_id,
+  uint16_t checksum,
+  struct Growth *growth,
+  struct Attacks *attacks,
+  struct Condition *condition,
+  struct Misc *misc
+) {
+  uint8_t buf[DATA_LENGTH];
+  const uint8_t *_src = (const uint8_t *) src;
+  const uint8_t *offset = datum_offset[personality % DATUM_ORDERS];
+  uint32_t key = personality ^ trainer_id;
+
+  for(size_t i = 0; i < DATA_LENGTH; i += sizeof(uint32_t)) {
+    store32(buf + i, load32(_src + i) ^ key);
+  }
+
+  growth_unpack(growth, buf + offset[DATUM_GROWTH]);
+  attacks_unpack(attacks, buf + offset[DATUM_ATTACKS]);
+  condition_unpack(condition, buf + offset[DATUM_CONDITION]);
+  misc_unpack(misc, buf + offset[DATUM_MISC]);
+  return data_checksum(buf, DATA_LENGTH) == checksum;
+}
+
+/* Batch checksum and encryption kernels
+ * Each takes n records, stride bytes apart, laid out like the start of a
+ * struct Pokemon (so either party or box pokémon) whose data holds assembled,
+ * unencrypted structures, and sets their checksum and encrypts their data in
+ * place. The encrypted records are in the games' byte order; the vector
+ * kernels are only built for x86, which is little-endian already. */
+#define RECORD_DATA offsetof(struct Pokemon, data)
+#define HOST_LITTLE_ENDIAN (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+
+static void swap16(uint8_t *p) {
+  uint16_t v;
+  memcpy(&v, p, sizeof(v));
+  store16(p, v);
+}
+
+static void swap32(uint8_t *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  store32(p, v);
+}
+
+// Convert the fields of a record outside data from host byte order to the
+// games', or back again; there's nothing to do on little-endian hosts
+static void record_byte_order(uint8_t *record, size_t stride) {
+  if(HOST_LITTLE_ENDIAN) return;
+
+  swap32(record + offsetof(struct Pokemon, personality));
+  swap32(record + offsetof(struct Pokemon, trainer_id));
+  swap16(record + offsetof(struct Pokemon, language));
+  swap16(record + offsetof(struct Pokemon, checksum));
+  swap16(record + offsetof(struct Pokemon, unknown));
+  if(stride >= sizeof(struct Pokemon)) {
+    swap32(record + offsetof(struct Pokemon, status));
+    for(size_t i = offsetof(struct Pokemon, current_health); i < sizeof(struct Pokemon); i += 2) {
+      swap16(record + i);
+    }
+  }
+}
+
+static inline uint32_t record_key(const uint8_t *record) {
+  uint32_t personality, trainer_id;
+  memcpy(&personality, record + offsetof(struct Pokemon, personality), sizeof(personality));
+  memcpy(&trainer_id, record + offsetof(struct Pokemon, trainer_id), sizeof(trainer_id));
+  return personality ^ trainer_id;
+}
+
+static inline void record_set_checksum(uint8_t *record, uint16_t cksum) {
+  memcpy(record + offsetof(struct Pokemon, checksum), &cksum, sizeof(cksum));
+}
+
+static void data_encrypt_scalar(uint8_t *records, size_t stride, size_t n) {
+  for(size_t i = 0; i < n; i++, records += stride) {
+    uint8_t *data = records + RECORD_DATA;
+
+    record_set_checksum(records, data_checksum(data, DATA_LENGTH));
+    data_crypt(data, DATA_LENGTH, record_key(records));
+    record_byte_order(records, stride);
+  }
+}
+
+#ifdef HAVE_X86_SIMD
+// One pokémon per iteration; data is three 16 byte vectors
+__attribute__((target("sse2")))
+static void data_encrypt_sse2(uint8_t *records, size_t stride, size_t n) {
+  for(size_t i = 0; i < n; i++, records += stride) {
+    __m128i *data = (__m128i *) (records + RECORD_DATA);
+    __m128i a = _mm_loadu_si128(data);
+    __m128i b = _mm_loadu_si128(data + 1);
+    __m128i c = _mm_loadu_si128(data + 2);
+
+    // Sum the 24 halfwords down to one
+    __m128i sum = _mm_add_epi16(_mm_add_epi16(a, b), c);
+    sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 8));
+    sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 4));
+    sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 2));
+    record_set_checksum(records, (uint16_t) _mm_cvtsi128_si32(sum));
+
+    __m128i key = _mm_set1_epi32((int) record_key(records));
+    _mm_storeu_si128(data, _mm_xor_si128(a, key));
+    _mm_storeu_si128(data + 1, _mm_xor_si128(b, key));
+    _mm_storeu_si128(data + 2, _mm_xor_si128(c, key));
+  }
+}
+
+// Two pokémon per iteration, one in each 128 bit lane
+__attribute__((target("avx2")))
+static void data_encrypt_avx2(uint8_t *records, size_t stride, size_t n) {
+  size_t i;
+
+  for(i = 0; i + 2 <= n; i += 2, records += 2 * stride) {
+    __m128i *lo = (__m128i *) (records + RECORD_DATA);
+    __m128i *hi = (__m128i *) (records + stride + RECORD_DATA);
+    __m256i a = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128(lo)), _mm_loadu_si128(hi), 1);
+    __m256i b = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128(lo + 1)), _mm_loadu_si128(hi + 1), 1);
+    __m256i c = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128(lo + 2)), _mm_loadu_si128(hi + 2), 1);
+
+    // Byte shifts stay within lanes, so each lane sums its own pokémon
+    __m256i sum = _mm256_add_epi16(_mm256_add_epi16(a, b), c);
+    sum = _mm256_add_epi16(sum, _mm256_srli_si256(sum, 8));
+    sum = _mm256_add_epi16(sum, _mm256_srli_si256(sum, 4));
+    sum = _mm256_add_epi16(sum, _mm256_srli_si256(sum, 2));
+    record_set_checksum(records, (uint16_t) _mm256_extract_epi16(sum, 0));
+    record_set_checksum(records + stride, (uint16_t) _mm256_extract_epi16(sum, 8));
+
+    __m256i key = _mm256_inserti128_si256(
+      _mm256_set1_epi32((int) record_key(records)),
+      _mm_set1_epi32((int) record_key(records + stride)), 1);
+    a = _mm256_xor_si256(a, key);
+    b = _mm256_xor_si256(b, key);
+    c = _mm256_xor_si256(c, key);
+
+    _mm_storeu_si128(lo, _mm256_castsi256_si128(a));
+    _mm_storeu_si128(lo + 1, _mm256_castsi256_si128(b));
+    _mm_storeu_si128(lo + 2, _mm256_castsi256_si128(c));
+    _mm_storeu_si128(hi, _mm256_extracti128_si256(a, 1));
+    _mm_storeu_si128(hi + 1, _mm256_extracti128_si256(b, 1));
+    _mm_storeu_si128(hi + 2, _mm256_extracti128_si256(c, 1));
+  }
+
+  data_encrypt_sse2(records, stride, n - i);
+}
+#endif
+
+// Checksum and encrypt n assembled records, stride bytes apart,
+// with the best available kernel
+static void data_encrypt_records(void *records, size_t stride, size_t n) {
+#ifdef HAVE_X86_SIMD
+  if(__builtin_cpu_supports("avx2")) {
+    data_encrypt_avx2((uint8_t *) records, stride, n);
+    return;
+  } else if(__builtin_cpu_supports("sse2")) {
+    data_encrypt_sse2((uint8_t *) records, stride, n);
+    return;
+  }
+#endif
+  data_encrypt_scalar((uint8_t *) records, stride, n);
+}
+
+// Checksum and encrypt n assembled pokémon
+void pokegen_encode(struct Pokemon *pkmn, size_t n) {
+  data_encrypt_records(pkmn, sizeof(struct Pokemon), n);
+}
+
+/* Generation Ⅲ character sets
+ * Japanese games use one set, and every other language shares the other. */
+#define PCS_JAPANESE 0
+#define PCS_INTERNATIONAL 1
+#define PCS_CHARSETS 2
+#define PCS_TERMINATOR 0xff
+#define PCS_NONE 0xffff
+
+// Code of each ASCII character, or PCS_NONE if it has none, by [charset][char]
+// In the Japanese set, ASCII stands in for the full width forms.
+static const uint16_t pcs_ascii[PCS_CHARSETS][128] = {
+  { // Japanese
+    0x00ff, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x00
+    PCS_NONE, PCS_NONE, 0x00fe, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x08
+    PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x10
+    PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x18
+    0x0000, 0x00ab, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x20
+    PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, 0x00b8, 0x00ba, // 0x28
+    0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, // 0x30
+    0x00a9, 0x00aa, 0x00f0, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, 0x00ac, // 0x38
+    PCS_NONE, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, // 0x40
+    0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, // 0x48
+    0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, // 0x50
+    0x00d2, 0x00d3, 0x00d4, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x58
+    PCS_NONE, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, // 0x60
+    0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00e2, 0x00e3, // 0x68
+    0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, // 0x70
+    0x00ec, 0x00ed, 0x00ee, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE  // 0x78
+  },
+  { // International
+    0x00ff, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x00
+    PCS_NONE, PCS_NONE, 0x00fe, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x08
+    PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x10
+    PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x18
+    0x0000, 0x00ab, PCS_NONE, PCS_NONE, PCS_NONE, 0x005b, 0x002d, PCS_NONE, // 0x20
+    0x005c, 0x005d, PCS_NONE, 0x002e, 0x00b8, 0x00ae, 0x00ad, 0x00ba, // 0x28
+    0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, // 0x30
+    0x00a9, 0x00aa, 0x00f0, 0x0036, PCS_NONE, 0x0035, PCS_NONE, 0x00ac, // 0x38
+    PCS_NONE, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, // 0x40
+    0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, // 0x48
+    0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, // 0x50
+    0x00d2, 0x00d3, 0x00d4, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, // 0x58
+    PCS_NONE, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, // 0x60
+    0x00dc, 0x00dd, 0x00de, 0x00df, 0x00e0, 0x00e1, 0x00e2, 0x00e3, // 0x68
+    0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, // 0x70
+    0x00ec, 0x00ed, 0x00ee, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE, PCS_NONE  // 0x78
+  }
+};
+
+// Unicode code point of each code, or 0 if it has none, by [charset][code]
+// Control codes, and glyphs such as "PK" and "Lv" without a code point, are left
+// out, so names containing them can't be decoded.
+static const uint16_t pcs_chars[PCS_CHARSETS][256] = {
+  { // Japanese
+    0x3000, 0x3042, 0x3044, 0x3046, 0x3048, 0x304a, 0x304b, 0x304d, // 0x00
+    0x304f, 0x3051, 0x3053, 0x3055, 0x3057, 0x3059, 0x305b, 0x305d, // 0x08
+    0x305f, 0x3061, 0x3064, 0x3066, 0x3068, 0x306a, 0x306b, 0x306c, // 0x10
+    0x306d, 0x306e, 0x306f, 0x3072, 0x3075, 0x3078, 0x307b, 0x307e, // 0x18
+    0x307f, 0x3080, 0x3081, 0x3082, 0x3084, 0x3086, 0x3088, 0x3089, // 0x20
+    0x308a, 0x308b, 0x308c, 0x308d, 0x308f, 0x3092, 0x3093, 0x3041, // 0x28
+    0x3043, 0x3045, 0x3047, 0x3049, 0x3083, 0x3085, 0x3087, 0x304c, // 0x30
+    0x304e, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305a, 0x305c, // 0x38
+    0x305e, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070, 0x3073, // 0x40
+    0x3076, 0x3079, 0x307c, 0x3071, 0x3074, 0x3077, 0x307a, 0x307d, // 0x48
+    0x3063, 0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab, 0x30ad, // 0x50
+    0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7, 0x30b9, 0x30bb, 0x30bd, // 0x58
+    0x30bf, 0x30c1, 0x30c4, 0x30c6, 0x30c8, 0x30ca, 0x30cb, 0x30cc, // 0x60
+    0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db, 0x30de, // 0x68
+    0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4, 0x30e6, 0x30e8, 0x30e9, // 0x70
+    0x30ea, 0x30eb, 0x30ec, 0x30ed, 0x30ef, 0x30f2, 0x30f3, 0x30a1, // 0x78
+    0x30a3, 0x30a5, 0x30a7, 0x30a9, 0x30e3, 0x30e5, 0x30e7, 0x30ac, // 0x80
+    0x30ae, 0x30b0, 0x30b2, 0x30b4, 0x30b6, 0x30b8, 0x30ba, 0x30bc, // 0x88
+    0x30be, 0x30c0, 0x30c2, 0x30c5, 0x30c7, 0x30c9, 0x30d0, 0x30d3, // 0x90
+    0x30d6, 0x30d9, 0x30dc, 0x30d1, 0x30d4, 0x30d7, 0x30da, 0x30dd, // 0x98
+    0x30c3, 0xff10, 0xff11, 0xff12, 0xff13, 0xff14, 0xff15, 0xff16, // 0xa0
+    0xff17, 0xff18, 0xff19, 0xff01, 0xff1f, 0x3002, 0x30fc, 0x30fb, // 0xa8
+    0x2025, 0x300e, 0x300f, 0x300c, 0x300d, 0x2642, 0x2640, 0x5186, // 0xb0
+    0xff0e, 0x00d7, 0xff0f, 0xff21, 0xff22, 0xff23, 0xff24, 0xff25, // 0xb8
+    0xff26, 0xff27, 0xff28, 0xff29, 0xff2a, 0xff2b, 0xff2c, 0xff2d, // 0xc0
+    0xff2e, 0xff2f, 0xff30, 0xff31, 0xff32, 0xff33, 0xff34, 0xff35, // 0xc8
+    0xff36, 0xff37, 0xff38, 0xff39, 0xff3a, 0xff41, 0xff42, 0xff43, // 0xd0
+    0xff44, 0xff45, 0xff46, 0xff47, 0xff48, 0xff49, 0xff4a, 0xff4b, // 0xd8
+    0xff4c, 0xff4d, 0xff4e, 0xff4f, 0xff50, 0xff51, 0xff52, 0xff53, // 0xe0
+    0xff54, 0xff55, 0xff56, 0xff57, 0xff58, 0xff59, 0xff5a, 0x25b6, // 0xe8
+    0xff1a, 0x00c4, 0x00d6, 0x00dc, 0x00e4, 0x00f6, 0x00fc, 0x0000, // 0xf0
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000a, 0x0000  // 0xf8
+  },
+  { // International
+    0x0020, 0x00c0, 0x00c1, 0x00c2, 0x00c7, 0x00c8, 0x00c9, 0x00ca, // 0x00
+    0x00cb, 0x00cc, 0x0000, 0x00ce, 0x00cf, 0x00d2, 0x00d3, 0x00d4, // 0x08
+    0x0152, 0x00d9, 0x00da, 0x00db, 0x00d1, 0x00df, 0x00e0, 0x00e1, // 0x10
+    0x0000, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x0000, // 0x18
+    0x00ee, 0x00ef, 0x00f2, 0x00f3, 0x00f4, 0x0153, 0x00f9, 0x00fa, // 0x20
+    0x00fb, 0x00f1, 0x00ba, 0x00aa, 0x0000, 0x0026, 0x002b, 0x0000, // 0x28
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003d, 0x003b, 0x0000, // 0x30
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x38
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x40
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x48
+    0x0000, 0x00bf, 0x00a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x50
+    0x0000, 0x0000, 0x00cd, 0x0025, 0x0028, 0x0029, 0x0000, 0x0000, // 0x58
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x60
+    0x00e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ed, // 0x68
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x70
+    0x0000, 0x2191, 0x2193, 0x2190, 0x2192, 0x0000, 0x0000, 0x0000, // 0x78
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x80
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x88
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x90
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, // 0x98
+    0x0000, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, // 0xa0
+    0x0037, 0x0038, 0x0039, 0x0021, 0x003f, 0x002e, 0x002d, 0x00b7, // 0xa8
+    0x2026, 0x201c, 0x201d, 0x2018, 0x2019, 0x2642, 0x2640, 0x0000, // 0xb0
+    0x002c, 0x00d7, 0x002f, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, // 0xb8
+    0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, // 0xc0
+    0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, // 0xc8
+    0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, // 0xd0
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, // 0xd8
+    0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, // 0xe0
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x25b6, // 0xe8
+    0x003a, 0x00c4, 0x00d6, 0x00dc, 0x00e4, 0x00f6, 0x00fc, 0x0000, // 0xf0
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000a, 0x0000  // 0xf8
+  }
+};
+
+// Character set used by language, or -1 if it isn't one of LANGUAGE_*
+static int pcs_charset(uint16_t language) {
+  switch(language) {
+  case LANGUAGE_JAPANESE:
+  case LANGUAGE_EGG:
+    return PCS_JAPANESE;
+  case LANGUAGE_ENGLISH:
+  case LANGUAGE_FRENCH:
+  case LANGUAGE_ITALIAN:
+  case LANGUAGE_GERMAN:
+  case LANGUAGE_KOREAN:
+  case LANGUAGE_SPANISH:
+    return PCS_INTERNATIONAL;
+  default:
+    return -1;
+  }
+}
+
+// Decode the two or three byte UTF-8 sequence at *p, and advance *p past it
+// returns 0 if there isn't one
+static uint32_t utf8_next(const uint8_t **p, const uint8_t *end) {
+  const uint8_t *s = *p;
+
+  if((s[0] & 0xe0) == 0xc0 && end - s >= 2 && (s[1] & 0xc0) == 0x80) {
+    *p += 2;
+    return ((uint32_t) (s[0] & 0x1f) << 6) | (s[1] & 0x3f);
+  } else if((s[0] & 0xf0) == 0xe0 && end - s >= 3 &&
+            (s[1] & 0xc0) == 0x80 && (s[2] & 0xc0) == 0x80) {
+    *p += 3;
+    return ((uint32_t) (s[0] & 0x0f) << 12) | ((uint32_t) (s[1] & 0x3f) << 6) | (s[2] & 0x3f);
+  }
+  return 0;
+}
+
+// Code of Unicode code point cp in charset, or PCS_NONE if it has none
+static uint16_t pcs_code(int charset, uint32_t cp) {
+  if(cp < 0x80) return pcs_ascii[charset][cp];
+
+  for(unsigned code = 0; code < PCS_TERMINATOR; code++) {
+    if(pcs_chars[charset][code] == cp) return (uint16_t) code;
+  }
+  return PCS_NONE;
+}
+
+#ifdef HAVE_X86_SIMD
+// Convert n ASCII characters 16 at a time, by lookups on their high nibbles
+// Only digits, letters and spaces (which have the same codes in both sets) are
+// handled; returns false, with dest partly written, if there are any others.
+__attribute__((target("ssse3")))
+static bool pcs_encode_ssse3(uint8_t *dest, const uint8_t *text, size_t n) {
+  // By high nibble, the range of low nibbles handled and what to add to them
+  const __m128i lo_min = _mm_setr_epi8(0, 16, 0, 0, 1, 0, 1, 0,
+                                       16, 16, 16, 16, 16, 16, 16, 16);
+  const __m128i lo_max = _mm_setr_epi8(0, -1, 0, 9, 15, 10, 15, 10,
+                                       -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i offset = _mm_setr_epi8(-0x01, 0, -0x20, 0x71, 0x7a, 0x7a, 0x74, 0x74,
+                                       0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+  uint8_t buf[16];
+
+  for(size_t i = 0; i < n; i += 16) {
+    size_t k = n - i < 16 ? n - i : 16;
+    memset(buf, 0, sizeof(buf));
+    memcpy(buf, text + i, k);
+
+    __m128i c = _mm_loadu_si128((const __m128i *) buf);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(c, 4), nibble);
+    __m128i lo = _mm_and_si128(c, nibble);
+    __m128i bad = _mm_or_si128(
+      _mm_cmpgt_epi8(_mm_shuffle_epi8(lo_min, hi), lo),
+      _mm_cmpgt_epi8(lo, _mm_shuffle_epi8(lo_max, hi))
+    );
+    if(_mm_movemask_epi8(bad) != 0) return false;
+
+    _mm_storeu_si128((__m128i *) buf, _mm_add_epi8(c, _mm_shuffle_epi8(offset, hi)));
+    memcpy(dest + i, buf, k);
+  }
+
+  return true;
+}
+#endif
+
+// Convert UTF-8 text, of at most size bytes, into a name of len codes in the
+// character set of language, padded with terminators; longer text is cut short
+// returns false if a character isn't in that set, or language isn't known
+static bool pcs_encode(void *dest, size_t len, const char *text, size_t size, uint16_t language) {
+  const uint8_t *p = (const uint8_t *) text, *end = p + strnlen(text, size);
+  uint8_t *out = (uint8_t *) dest;
+  size_t n = 0;
+  int charset = pcs_charset(language);
+
+  if(charset < 0) return false;
+
+#ifdef HAVE_X86_SIMD
+  if((size_t) (end - p) <= len && __builtin_cpu_supports("ssse3") &&
+     pcs_encode_ssse3(out, p, (size_t) (end - p))) {
+    n = (size_t) (end - p);
+    p = end;
+  }
+#endif
+
+  while(p < end && n < len) {
+    uint32_t cp = *p < 0x80 ? *p++ : utf8_next(&p, end);
+    uint16_t code = cp != 0 ? pcs_code(charset, cp) : PCS_NONE;
+    if(code == PCS_NONE) return false;
+    out[n++] = (uint8_t) code;
+  }
+
+  memset(out + n, PCS_TERMINATOR, len - n);
+  return true;
+}
+
+// Convert a name of up to len codes in the character set of language into
+// NUL terminated UTF-8 text, in a buffer of size bytes
+// returns false, leaving text empty, if a code has no character, the text
+// doesn't fit, or language isn't known
+static bool pcs_decode(char *text, size_t size, const void *src, size_t len, uint16_t language) {
+  const uint8_t *in = (const uint8_t *) src;
+  size_t n = 0;
+  int charset = pcs_charset(language);
+
+  if(size == 0) return false;
+  text[0] = '\0';
+  if(charset < 0) return false;
+
+  for(size_t i = 0; i < len && in[i] != PCS_TERMINATOR; i++) {
+    uint32_t cp = pcs_chars[charset][in[i]];
+    size_t width = cp < 0x80 ? 1 : cp < 0x800 ? 2 : 3;
+    if(cp == 0 || n + width >= size) {
+      text[0] = '\0';
+      return false;
+    }
+
+    if(width == 1) {
+      text[n++] = (char) cp;
+    } else if(width == 2) {
+      text[n++] = (char) (0xc0 | (cp >> 6));
+      text[n++] = (char) (0x80 | (cp & 0x3f));
+    } else {
+      text[n++] = (char) (0xe0 | (cp >> 12));
+      text[n++] = (char) (0x80 | ((cp >> 6) & 0x3f));
+      text[n++] = (char) (0x80 | (cp & 0x3f));
+    }
+  }
+
+  text[n] = '\0';
+  return true;
+}
+
+
+/* Game data name lookup
+ * The tables themselves are generated into pokegen-data.c by data/generate.py,
+ * which must fold and hash names exactly as these functions do. */
+
+// Fold name into key as names are compared: letters in lower case and digits,
+// with é, ♀ and ♂ as e, f and m, and anything else skipped
+// returns the length of key, or NAME_KEY_MAX if name is too long to be one
+static size_t name_key(char key[NAME_KEY_MAX], const char *name) {
+  const unsigned char *p = (const unsigned char *) name;
+  size_t len = 0;
+
+  while(*p != '\0' && len < NAME_KEY_MAX) {
+    if(*p >= 'A' && *p <= 'Z') {
+      key[len++] = (char) (*p++ + ('a' - 'A'));
+    } else if((*p >= 'a' && *p <= 'z') || (*p >= '0' && *p <= '9')) {
+      key[len++] = (char) *p++;
+    } else if(p[0] == 0xc3 && (p[1] == 0xa9 || p[1] == 0x89)) {
+      key[len++] = 'e';
+      p += 2;
+    } else if(p[0] == 0xe2 && p[1] == 0x99 && (p[2] == 0x80 || p[2] == 0x82)) {
+      key[len++] = p[2] == 0x80 ? 'f' : 'm';
+      p += 3;
+    } else {
+      p++;
+    }
+  }
+
+  return *p == '\0' ? len : NAME_KEY_MAX;
+}
+
+// FNV-1a, plus a final mix, of a folded name
+static uint32_t name_hash(const char *key, size_t len, uint32_t seed) {
+  uint32_t h = 0x811c9dc5 ^ seed;
+
+  for(size_t i = 0; i < len; i++) h = (h ^ (uint8_t) key[i]) * 0x01000193;
+  h ^= h >> 15;
+  h *= 0x2c1b3c6d;
+  h ^= h >> 12;
+  return h;
+}
+
+// Find the value of name in table
+// returns false if it isn't there
+static bool name_lookup(const struct NameTable *table, const char *name, uint16_t *value) {
+  char key[NAME_KEY_MAX];
+  size_t len = name_key(key, name);
+  if(len == NAME_KEY_MAX) return false;
+
+  uint16_t seed = table->seeds[name_hash(key, len, 0) % table->buckets];
+  uint16_t entry = table->slots[name_hash(key, len, seed) & (table->size - 1)];
+  if(entry == 0) return false;
+
+  const char *found = table->keys[entry - 1];
+  if(strncmp(found, key, len) != 0 || found[len] != '\0') return false;
+  *value = table->values[entry - 1];
+  return true;
+}
+
+// Parse arg as a number, decimal or with a 0x or 0 prefix, no more than max
+// returns false if it isn't one
+static bool number_parse(const char *arg, uint32_t max, uint32_t *value) {
+  char *end;
+  unsigned long long v;
+
+  if(*arg < '0' || *arg > '9') return false;
+  errno = 0;
+  v = strtoull(arg, &end, 0);
+  if(errno != 0 || *end != '\0' || v > max) return false;
+  *value = (uint32_t) v;
+  return true;
+}
+
+// Parse arg as the number what, no more than max
+// returns false (after complaining) if it isn't one
+static bool field_parse(const char *what, const char *arg, uint32_t max, uint32_t *value) {
+  if(!number_parse(arg, max, value)) {
+    complain("%s must be a number from 0 to %lu", what, (unsigned long) max);
+    return false;
+  }
+  return true;
+}
+
+// Parse arg as either an index number or a name from table
+// returns false (after complaining) if it's neither
+static bool index_parse(const struct NameTable *table, const char *what,
+                        const char *arg, uint16_t *value) {
+  uint32_t v;
+
+  if(*arg >= '0' && *arg <= '9') {
+    if(!field_parse(what, arg, UINT16_MAX, &v)) return false;
+    *value = (uint16_t) v;
+  } else if(!name_lookup(table, arg, value)) {
+    complain("unknown %s '%s'", what, arg);
+    return false;
+  }
+  return true;
+}
+
+/* Derived fields
+ * Level, experience, PP and stats follow from the rest of a pokémon just as
+ * the games calculate them, from the base stats, growth rates and move PP in
+ * pokegen-data.c. Stats are calculated six at a time, one per lane, with
+ *   HP:     (2 * base + IV + EV / 4) * level / 100 + level + 10
+ *   others: ((2 * base + IV + EV / 4) * level / 100 + 5) * nature / 10
+ * where nature is 11 for the stat it raises, 9 for the one it lowers and 10
+ * otherwise; HP takes the same form with add = level + 10 and nature = 10. */
+#define DERIVE_BATCH 64
+
+struct StatTerms {
+  int32_t core[DERIVE_BATCH * STATS];
+  int32_t level[DERIVE_BATCH * STATS];
+  int32_t add[DERIVE_BATCH * STATS];
+  int32_t nature[DERIVE_BATCH * STATS];
+  int32_t stat[DERIVE_BATCH * STATS];
+};
+
+static void stats_scalar(struct StatTerms *t, size_t start, size_t n) {
+  for(size_t i = start; i < n; i++) {
+    t->stat[i] = (t->core[i] * t->level[i] / 100 + t->add[i]) * t->nature[i] / 10;
+  }
+}
+
+#ifdef HAVE_X86_SIMD
+// Eight stats per iteration, and a masked iteration for any left over. Every
+// quotient is well inside float precision, so truncating float division
+// gives exactly the integer result.
+__attribute__((target("avx2")))
+static void stats_avx2(struct StatTerms *t, size_t n) {
+  const __m256 hundred = _mm256_set1_ps(100.0f), ten = _mm256_set1_ps(10.0f);
+
+  for(size_t i = 0; i < n; i += 8) {
+    __m256i mask = _mm256_cmpgt_epi32(
+      _mm256_set1_epi32((int) (n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256i core = _mm256_maskload_epi32((const int *) &t->core[i], mask);
+    __m256i level = _mm256_maskload_epi32((const int *) &t->level[i], mask);
+    __m256i add = _mm256_maskload_epi32((const int *) &t->add[i], mask);
+    __m256i nature = _mm256_maskload_epi32((const int *) &t->nature[i], mask);
+
+    __m256i x = _mm256_cvttps_epi32(_mm256_div_ps(
+      _mm256_cvtepi32_ps(_mm256_mullo_epi32(core, level)), hundred));
+    x = _mm256_mullo_epi32(_mm256_add_epi32(x, add), nature);
+    x = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(x), ten));
+    _mm256_maskstore_epi32((int *) &t->stat[i], mask, x);
+  }
+}
+#endif
+
+// Calculate the first n stats of t with the best available kernel
+static void stats_calculate(struct StatTerms *t, size_t n) {
+#ifdef HAVE_X86_SIMD
+  if(__builtin_cpu_supports("avx2")) {
+    stats_avx2(t, n);
+    return;
+  }
+#endif
+  stats_scalar(t, 0, n);
+}
+
+// Fill in the terms of one pokémon's six stats, starting at t[first]
+static void stat_terms(struct StatTerms *t, size_t first, uint16_t species,
+                       uint8_t level, uint32_t personality,
+                       const struct IVs *ivs, const struct Condition *condition) {
+  static const struct SpeciesInfo none = {{0}, 0};
+  const struct SpeciesInfo *info = species < SPECIES_COUNT ? &species_info[species] : &none;
+  const uint8_t iv[STATS] = {
+    ivs->hp, ivs->attack, ivs->defense,
+    ivs->speed, ivs->special_attack, ivs->special_defense
+  };
+  const uint8_t ev[STATS] = {
+    condition->hp_ev, condition->attack_ev, condition->defense_ev,
+    condition->speed_ev, condition->special_attack_ev, condition->special_defense_ev
+  };
+  unsigned nature = personality % 25;
+  unsigned raised = nature / 5 + 1, lowered = nature % 5 + 1;
+
+  for(size_t i = 0; i < STATS; i++) {
+    t->core[first + i] = 2 * info->base_stats[i] + iv[i] + ev[i] / 4;
+    t->level[first + i] = level;
+    t->add[first + i] = i == STAT_HP ? level + 10 : 5;
+    // Neutral natures raise and lower the same stat, which cancels out
+    t->nature[first + i] = 10 + (i == raised) - (i == lowered);
+  }
+}
+
+// Store calculated stats into the fields derive selects
+static void stats_store(struct Pokemon *dest, const int32_t *stat,
+                        uint16_t species, uint16_t derive) {
+  // Shedinja's HP is always 1, which its base HP stands in for
+  uint16_t health = species < SPECIES_COUNT && species_info[species].base_stats[STAT_HP] == 1
+    ? 1 : (uint16_t) stat[STAT_HP];
+
+  if(derive & DERIVE_MAX_HP) dest->max_health = health;
+  if(derive & DERIVE_HP) dest->current_health = dest->max_health;
+  if(derive & DERIVE_ATTACK) dest->attack = (uint16_t) stat[STAT_ATTACK];
+  if(derive & DERIVE_DEFENSE) dest->defense = (uint16_t) stat[STAT_DEFENSE];
+  if(derive & DERIVE_SPEED) dest->speed = (uint16_t) stat[STAT_SPEED];
+  if(derive & DERIVE_SPECIAL_ATTACK) dest->special_attack = (uint16_t) stat[STAT_SPECIAL_ATTACK];
+  if(derive & DERIVE_SPECIAL_DEFENSE) dest->special_defense = (uint16_t) stat[STAT_SPECIAL_DEFENSE];
+}
+
+// Level that a pokémon with experience has reached at growth_rate
+uint8_t pokegen_level(uint8_t growth_rate, uint32_t experience) {
+  const uint32_t *table = experience_table[growth_rate % GROWTH_RATES];
+  size_t level = 0, span = MAX_LEVEL + 1;
+
+  // Branchless binary search, since experience is usually unpredictable;
+  // levels 0 and 1 both need none, so this never ends below 1
+  while(span > 1) {
+    size_t half = span / 2;
+    level = table[level + half] <= experience ? level + half : level;
+    span -= half;
+  }
+  return (uint8_t) level;
+}
+
+// Derive the level, experience and PP that derive selects, in growth and attacks
+static void derive_growth(uint16_t derive, struct Pokemon *dest,
+                          struct Growth *growth, struct Attacks *attacks) {
+  if(growth->species < SPECIES_COUNT) {
+    uint8_t rate = species_info[growth->species].growth_rate;
+    if(derive & DERIVE_EXPERIENCE) {
+      growth->experience = experience_table[rate][dest->level < MAX_LEVEL ? dest->level : MAX_LEVEL];
+    } else if(derive & DERIVE_LEVEL) {
+      dest->level = pokegen_level(rate, growth->experience);
+    }
+  }
+
+  if(derive & DERIVE_PP) {
+    const uint8_t bonus[4] = {
+      growth->pp_bonus.move1, growth->pp_bonus.move2,
+      growth->pp_bonus.move3, growth->pp_bonus.move4
+    };
+    for(size_t i = 0; i < 4; i++) {
+      uint16_t move = attacks->moves[i];
+      attacks->pp[i] = move < MOVES_COUNT ? (uint8_t) (move_pp[move] * (5 + bonus[i]) / 5) : 0;
+    }
+  }
+}
+
+// Derive every field from assembled, unencrypted pokémon in place: level from
+// experience, PP from moves and PP Ups, and stats and current HP
+void pokegen_derive_records(struct Pokemon *pkmn, size_t n) {
+  struct StatTerms terms;
+  uint16_t species[DERIVE_BATCH];
+
+  for(size_t start = 0; start < n; start += DERIVE_BATCH) {
+    size_t count = n - start < DERIVE_BATCH ? n - start : DERIVE_BATCH;
+
+    for(size_t i = 0; i < count; i++) {
+      struct Pokemon *p = &pkmn[start + i];
+      const uint8_t *offset = datum_offset[p->personality % DATUM_ORDERS];
+      struct Growth growth;
+      struct Attacks attacks;
+      struct Condition condition;
+      struct Misc misc;
+
+      growth_unpack(&growth, p->data + offset[DATUM_GROWTH]);
+      attacks_unpack(&attacks, p->data + offset[DATUM_ATTACKS]);
+      condition_unpack(&condition, p->data + offset[DATUM_CONDITION]);
+      misc_unpack(&misc, p->data + offset[DATUM_MISC]);
+
+      derive_growth(DERIVE_LEVEL | DERIVE_PP, p, &growth, &attacks);
+      attacks_pack(p->data + offset[DATUM_ATTACKS], &attacks);
+
+      species[i] = growth.species;
+      stat_terms(&terms, i * STATS, growth.species, p->level, p->personality,
+                 &misc.ivs, &condition);
+    }
+
+    stats_calculate(&terms, count * STATS);
+    for(size_t i = 0; i < count; i++) {
+      stats_store(&pkmn[start + i], &terms.stat[i * STATS], species[i], DERIVE_STATS | DERIVE_HP);
+    }
+  }
+}
+
+/* Legality checks
+ * Each check is a comparison or a bit test against the tables generated from
+ * the data/ directory, so that fuzzed corpora can be filtered quickly. */
+
+// Check whether spec, as decoded from a pokémon, could have come from a game,
+// and set unchecked, unless it's NULL, to the ILLEGAL_* kinds the tables are
+// too incomplete to rule out: moves, for a species without a learnset
+// returns the ILLEGAL_* problems with it, or 0 if there are none
+uint32_t pokegen_check(const struct Spec *spec, uint32_t *unchecked) {
+  const struct Growth *growth = &spec->growth;
+  const struct Attacks *attacks = &spec->attacks;
+  const struct Condition *condition = &spec->condition;
+  const struct Origins *origins = &spec->misc.origins;
+  const struct IVs *ivs = &spec->misc.ivs;
+  uint16_t species = growth->species;
+  uint8_t level = spec->pkmn.level;
+  uint32_t illegal = 0;
+
+  bool known = species < SPECIES_COUNT && BITSET_TEST(legal_species, species);
+  if(!known) illegal |= ILLEGAL_SPECIES;
+  if(unchecked != NULL) {
+    *unchecked = known && !BITSET_TEST(learnsets_known, species) ? ILLEGAL_MOVES : 0;
+  }
+  if(growth->held_item >= ITEMS_COUNT || !BITSET_TEST(legal_items, growth->held_item)) {
+    illegal |= ILLEGAL_ITEM;
+  }
+
+  if(level < 1 || level > MAX_LEVEL) {
+    illegal |= ILLEGAL_LEVEL;
+  } else if(known) {
+    const uint32_t *experience = experience_table[species_info[species].growth_rate];
+    if(growth->experience < experience[level] ||
+       (level < MAX_LEVEL ? growth->experience >= experience[level + 1]
+                          : growth->experience > experience[level])) {
+      illegal |= ILLEGAL_LEVEL;
+    }
+  }
+
+  // Moves fill slots from the first, without repeating
+  const uint8_t bonus[4] = {
+    growth->pp_bonus.move1, growth->pp_bonus.move2,
+    growth->pp_bonus.move3, growth->pp_bonus.move4
+  };
+  if(attacks->moves[0] == 0) illegal |= ILLEGAL_MOVES;
+  for(size_t i = 0; i < 4; i++) {
+    uint16_t move = attacks->moves[i];
+
+    if(move >= MOVES_COUNT || (move != 0 && known && !BITSET_TEST(learnsets[species], move)) ||
+       (move != 0 && i > 0 && attacks->moves[i - 1] == 0)) {
+      illegal |= ILLEGAL_MOVES;
+      continue;
+    }
+    for(size_t j = 0; j < i; j++) {
+      if(move != 0 && attacks->moves[j] == move) illegal |= ILLEGAL_MOVES;
+    }
+    if(attacks->pp[i] > move_pp[move] * (5 + bonus[i]) / 5) illegal |= ILLEGAL_PP;
+  }
+
+  unsigned evs = condition->hp_ev + condition->attack_ev + condition->defense_ev +
+    condition->speed_ev + condition->special_attack_ev + condition->special_defense_ev;
+  if(evs > EV_TOTAL_MAX) illegal |= ILLEGAL_EVS;
+
+  // The lowest bit of the personality picks the ability
+  if(ivs->ability != (spec->pkmn.personality & 1)) illegal |= ILLEGAL_ABILITY;
+
+  const struct GameRules *rules = &game_rules[origins->game_met];
+  if(rules->balls == 0) {
+    illegal |= ILLEGAL_GAME;
+  } else {
+    if(!BITSET_TEST(rules->locations, spec->misc.met_location)) illegal |= ILLEGAL_LOCATION;
+    if(!((rules->balls >> origins->pokeball_type) & 1)) illegal |= ILLEGAL_BALL;
+  }
+
+  // Eggs are met at level 0, and hatch in a poké ball
+  if(origins->level_met == 0) {
+    if(origins->pokeball_type != POKEBALL_STANDARD) illegal |= ILLEGAL_BALL;
+  } else {
+    if(origins->level_met > level) illegal |= ILLEGAL_MET_LEVEL;
+    if(ivs->egg) illegal |= ILLEGAL_EGG;
+  }
+
+  return illegal;
+}
+
+/* Random pokémon
+ * Every field is drawn from the range the games allow, so random pokémon
+ * pass pokegen_check(). Each pokémon of a corpus draws from its own splitmix
+ * stream, started from the corpus seed and its index, so any one of them can
+ * be generated alone, and a corpus is the same however it's divided up. */
+#define RIBBON_RANKS 5 // none, then normal to master rank
+#define RIBBON_RANK_BITS 3
+#define RIBBON_CONTESTS 5
+#define RIBBON_FLAGS (RIBBON_CHAMPION | RIBBON_WINNING | RIBBON_VICTORY | RIBBON_ARTIST | \
+                      RIBBON_EFFORT | RIBBON_SPECIAL | RIBBON_OBEDIENCE)
+#define STATUS_KINDS 7 // none, sleep, then each of the other bits
+
+// Random number below n, by multiplying rather than dividing
+static uint32_t random_below(uint64_t *rng, uint32_t n) {
+  return (uint32_t) (((uint64_t) pokegen_random(rng) * n) >> 32);
+}
+
+// A random member of a bitset of words words, or 0 if it's empty
+static uint16_t random_member(uint64_t *rng, const uint32_t *set, size_t words) {
+  uint32_t members = 0;
+  for(size_t i = 0; i < words; i++) members += (uint32_t) __builtin_popcount(set[i]);
+  if(members == 0) return 0;
+
+  uint32_t skip = random_below(rng, members);
+  for(size_t i = 0;; i++) {
+    uint32_t n = (uint32_t) __builtin_popcount(set[i]);
+    if(skip < n) {
+      uint32_t word = set[i];
+      while(skip-- > 0) word &= word - 1; // clear the lowest members
+      return (uint16_t) (i * 32 + (size_t) __builtin_ctz(word));
+    }
+    skip -= n;
+  }
+}
+
+// Start of the random stream of pokémon index of the corpus seed
+uint64_t pokegen_stream(uint64_t seed, uint64_t index) {
+  uint64_t z = seed ^ ((index + 1) * 0xd1b54a32d192ed03ULL);
+  z = (z ^ (z >> 32)) * 0xdaba0b6eb09322e3ULL;
+  z = (z ^ (z >> 32)) * 0xdaba0b6eb09322e3ULL;
+  return z ^ (z >> 32);
+}
+
+// Randomise every field of spec but the names and language, drawing from rng
+// The personality and trainer ID are kept if they're set
+void pokegen_randomize(struct Spec *spec, uint64_t *rng) {
+  struct Growth *growth = &spec->growth;
+  struct Attacks *attacks = &spec->attacks;
+  struct Condition *condition = &spec->condition;
+  struct Misc *misc = &spec->misc;
+  struct Pokemon *pkmn = &spec->pkmn;
+
+  if(!spec->personality_set && !spec->seed_set) {
+    pkmn->personality = pokegen_random(rng);
+    spec->personality_set = true;
+  }
+  if(!spec->trainer_id_set) {
+    pkmn->trainer_id = pokegen_random(rng);
+    misc->origins.trainer_gender = (uint8_t) random_below(rng, 2);
+    spec->trainer_id_set = true;
+  }
+
+  growth->species = random_member(rng, legal_species, BITSET_WORDS(SPECIES_COUNT));
+  growth->held_item = random_member(rng, legal_items, BITSET_WORDS(ITEMS_COUNT));
+  growth->friendship = (uint8_t) pokegen_random(rng);
+  pkmn->level = (uint8_t) (1 + random_below(rng, MAX_LEVEL));
+
+  // One to four different moves from the learnset (none if it's empty), each
+  // with up to its full PP
+  const uint32_t *learnset = learnsets[growth->species];
+  uint32_t known = 0;
+  for(size_t i = 0; i < BITSET_WORDS(MOVES_COUNT); i++) {
+    known += (uint32_t) __builtin_popcount(learnset[i] & ~(i == 0 ? 1U : 0)); // not move 0
+  }
+  uint32_t moves = known == 0 ? 0 : 1 + random_below(rng, known < 4 ? known : 4);
+  uint8_t bonus[4];
+  for(size_t i = 0; i < 4; i++) {
+    uint16_t move = 0;
+    while(i < moves) {
+      move = random_member(rng, learnset, BITSET_WORDS(MOVES_COUNT));
+      bool repeated = move == 0;
+      for(size_t j = 0; j < i; j++) repeated |= attacks->moves[j] == move;
+      if(!repeated) break;
+    }
+    attacks->moves[i] = move;
+    bonus[i] = move != 0 ? (uint8_t) random_below(rng, 4) : 0;
+    attacks->pp[i] = (uint8_t) random_below(rng, move_pp[move] * (5U + bonus[i]) / 5 + 1);
+  }
+  growth->pp_bonus = (struct PPBonus) {
+    .move1 = bonus[0],
+    .move2 = bonus[1],
+    .move3 = bonus[2],
+    .move4 = bonus[3]
+  };
+
+  // EVs share a budget of 510, each taking up to 255 of what's left
+  uint8_t *evs[STATS] = {
+    &condition->hp_ev, &condition->attack_ev, &condition->defense_ev,
+    &condition->speed_ev, &condition->special_attack_ev, &condition->special_defense_ev
+  };
+  uint32_t left = EV_TOTAL_MAX;
+  for(size_t i = 0; i < STATS; i++) {
+    *evs[i] = (uint8_t) random_below(rng, (left < 255 ? left : 255) + 1);
+    left -= *evs[i];
+  }
+  condition->coolness = (uint8_t) pokegen_random(rng);
+  condition->beauty = (uint8_t) pokegen_random(rng);
+  condition->cuteness = (uint8_t) pokegen_random(rng);
+  condition->smartness = (uint8_t) pokegen_random(rng);
+  condition->toughness = (uint8_t) pokegen_random(rng);
+  condition->feel = (uint8_t) pokegen_random(rng);
+
+  misc->pokerus.days_remaining = (uint8_t) (pokegen_random(rng) & FIELD_MASK(POKERUS_BITS));
+  misc->pokerus.strain = (uint8_t) (pokegen_random(rng) & FIELD_MASK(POKERUS_BITS));
+
+  // A game with rules, then a location and ball it allows
+  uint32_t games = 0;
+  for(size_t i = 0; i < GAMES; i++) games |= (uint32_t) (game_rules[i].balls != 0) << i;
+  const struct GameRules *rules = &game_rules[random_member(rng, &games, 1)];
+  uint32_t balls = rules->balls;
+  misc->origins.game_met = (uint8_t) (rules - game_rules);
+  misc->met_location = (uint8_t) random_member(rng, rules->locations, BITSET_WORDS(LOCATIONS));
+  misc->origins.pokeball_type = (uint8_t) random_member(rng, &balls, 1);
+  misc->origins.level_met = (uint8_t) (1 + random_below(rng, pkmn->level));
+
+  misc->ivs.hp = (uint8_t) (pokegen_random(rng) & FIELD_MASK(IV_BITS));
+  misc->ivs.attack = (uint8_t) (pokegen_random(rng) & FIELD_MASK(IV_BITS));
+  misc->ivs.defense = (uint8_t) (pokegen_random(rng) & FIELD_MASK(IV_BITS));
+  misc->ivs.speed = (uint8_t) (pokegen_random(rng) & FIELD_MASK(IV_BITS));
+  misc->ivs.special_attack = (uint8_t) (pokegen_random(rng) & FIELD_MASK(IV_BITS));
+  misc->ivs.special_defense = (uint8_t) (pokegen_random(rng) & FIELD_MASK(IV_BITS));
+  misc->ivs.egg = 0;
+  // a seed decides the personality and IVs; they're still drawn above so the
+  // rest of the stream doesn't depend on it
+  if(spec->seed_set) {
+    pokegen_lcg_generate(spec->seed, spec->frame, spec->method, &pkmn->personality, &misc->ivs);
+  }
+  // the lowest bit of the personality picks the ability
+  misc->ivs.ability = pkmn->personality & 1;
+
+  misc->ribbons = pokegen_random(rng) & RIBBON_FLAGS;
+  for(size_t i = 0; i < RIBBON_CONTESTS; i++) {
+    misc->ribbons |= random_below(rng, RIBBON_RANKS) << (i * RIBBON_RANK_BITS);
+  }
+
+  pkmn->markings = (uint8_t) (pokegen_random(rng) & 0xf);
+  uint32_t status = random_below(rng, STATUS_KINDS);
+  pkmn->status = status == 0 ? 0
+    : status == 1 ? 1 + random_below(rng, STATUS_SLEEP)
+    : (uint32_t) STATUS_POISONED << (status - 2);
+
+  // Experience, PP and stats follow from the rest; the PP drawn above stays
+  spec->derive = (DERIVE_ALL & ~(DERIVE_LEVEL | DERIVE_PP));
+}
+
+/* Generation Ⅲ pseudorandom number generator
+ * A linear congruential generator; each call advances the seed one frame. */
+#define LCG_MULTIPLIER 0x41c64e6dU
+#define LCG_INCREMENT 0x6073U
+#define LCG_INVERSE_MULTIPLIER 0xeeb9eb65U
+#define LCG_INVERSE_INCREMENT 0x0a3561a1U
+
+// lcg_jump[i] advances a seed 2^i frames, as seed * [i][0] + [i][1]
+static const uint32_t lcg_jump[32][2] = {
+  {0x41c64e6d, 0x00006073}, // 2^0
+  {0xc2a29a69, 0xe97e7b6a}, // 2^1
+  {0xee067f11, 0x31b0dde4}, // 2^2
+  {0xcfdddf21, 0x67dbb608}, // 2^3
+  {0x5f748241, 0xcba72510}, // 2^4
+  {0x8b2e1481, 0x1d29ae20}, // 2^5
+  {0x76006901, 0xba84ec40}, // 2^6
+  {0x1711d201, 0x79f01880}, // 2^7
+  {0xbe67a401, 0x08793100}, // 2^8
+  {0xdddf4801, 0x6b566200}, // 2^9
+  {0x3ffe9001, 0x803cc400}, // 2^10
+  {0x90fd2001, 0xa6b98800}, // 2^11
+  {0x65fa4001, 0xe6731000}, // 2^12
+  {0xdbf48001, 0x30e62000}, // 2^13
+  {0xf7e90001, 0xf1cc4000}, // 2^14
+  {0xefd20001, 0x23988000}, // 2^15
+  {0xdfa40001, 0x47310000}, // 2^16
+  {0xbf480001, 0x8e620000}, // 2^17
+  {0x7e900001, 0x1cc40000}, // 2^18
+  {0xfd200001, 0x39880000}, // 2^19
+  {0xfa400001, 0x73100000}, // 2^20
+  {0xf4800001, 0xe6200000}, // 2^21
+  {0xe9000001, 0xcc400000}, // 2^22
+  {0xd2000001, 0x98800000}, // 2^23
+  {0xa4000001, 0x31000000}, // 2^24
+  {0x48000001, 0x62000000}, // 2^25
+  {0x90000001, 0xc4000000}, // 2^26
+  {0x20000001, 0x88000000}, // 2^27
+  {0x40000001, 0x10000000}, // 2^28
+  {0x80000001, 0x20000000}, // 2^29
+  {0x00000001, 0x40000000}, // 2^30
+  {0x00000001, 0x80000000}  // 2^31
+};
+
+static inline uint32_t lcg_next(uint32_t seed) {
+  return (seed * LCG_MULTIPLIER) + LCG_INCREMENT;
+}
+
+static inline uint32_t lcg_prev(uint32_t seed) {
+  return (seed * LCG_INVERSE_MULTIPLIER) + LCG_INVERSE_INCREMENT;
+}
+
+// Advance seed by frames frames, in logarithmic time
+static uint32_t lcg_advance(uint32_t seed, uint32_t frames) {
+  for(size_t i = 0; frames != 0; i++, frames >>= 1) {
+    if(frames & 1) seed = (seed * lcg_jump[i][0]) + lcg_jump[i][1];
+  }
+  return seed;
+}
+
+// Set the IVs packed into the top halves of two random numbers
+static void lcg_ivs(struct IVs *ivs, uint32_t iv1, uint32_t iv2) {
+  iv1 >>= 16;
+  iv2 >>= 16;
+  ivs->hp = iv1 & 0x1f;
+  ivs->attack = (iv1 >> 5) & 0x1f;
+  ivs->defense = (iv1 >> 10) & 0x1f;
+  ivs->speed = iv2 & 0x1f;
+  ivs->special_attack = (iv2 >> 5) & 0x1f;
+  ivs->special_defense = (iv2 >> 10) & 0x1f;
+}
+
+// Generate the personality and IVs, with the ability the personality picks, that
+// a wild pokémon gets at frame (the first being 1) of seed, with method 1, 2 or 4
+// returns false if method isn't one of those
+bool pokegen_lcg_generate(uint32_t seed, uint32_t frame, unsigned method,
+                          uint32_t *personality, struct IVs *ivs) {
+  uint32_t r[5];
+
+  seed = lcg_advance(seed, frame - 1);
+  for(size_t i = 0; i < 5; i++) {
+    r[i] = seed = lcg_next(seed);
+  }
+
+  *personality = (r[1] & 0xffff0000) | (r[0] >> 16);
+  switch(method) {
+  case METHOD_1: lcg_ivs(ivs, r[2], r[3]); break;
+  case METHOD_2: lcg_ivs(ivs, r[3], r[4]); break;
+  case METHOD_4: lcg_ivs(ivs, r[2], r[4]); break;
+  default: return false;
+  }
+  // the lowest bit of the personality picks the ability
+  ivs->ability = *personality & 1;
+  return true;
+}
+
+// The 15 bits of each random number that IVs are taken from
+static inline uint32_t lcg_iv_bits(uint32_t r) {
+  return (r >> 16) & 0x7fff;
+}
+
+// Find every seed whose first frame generates personality and ivs with some
+// method, storing up to max of them (and their methods) in seeds and methods
+// The personality fixes the top halves of the first two random numbers, so
+// only the 2^16 possible bottom halves of the first need to be tried.
+// returns the number found, which may be more than max
+size_t pokegen_lcg_find_seeds(uint32_t personality, const struct IVs *ivs,
+                              uint32_t *seeds, uint8_t *methods, size_t max) {
+  uint32_t iv1 = ivs->hp | (ivs->attack << 5) | (ivs->defense << 10);
+  uint32_t iv2 = ivs->speed | (ivs->special_attack << 5) | (ivs->special_defense << 10);
+  size_t found = 0;
+
+  for(uint32_t low = 0; low <= 0xffff; low++) {
+    uint32_t r1 = (personality << 16) | low;
+    uint32_t r2 = lcg_next(r1);
+    if((r2 >> 16) != (personality >> 16)) continue;
+
+    uint32_t r3 = lcg_next(r2), r4 = lcg_next(r3), r5 = lcg_next(r4);
+    static const uint8_t method[] = {METHOD_1, METHOD_2, METHOD_4};
+    const bool match[] = {
+      lcg_iv_bits(r3) == iv1 && lcg_iv_bits(r4) == iv2,
+      lcg_iv_bits(r4) == iv1 && lcg_iv_bits(r5) == iv2,
+      lcg_iv_bits(r3) == iv1 && lcg_iv_bits(r5) == iv2
+    };
+
+    for(size_t i = 0; i < sizeof(method); i++) {
+      if(!match[i]) continue;
+      if(found < max) {
+        seeds[found] = lcg_prev(r1);
+        methods[found] = method[i];
+      }
+      found++;
+    }
+  }
+
+  return found;
+}
+
+// Fill spec with the default pokémon
+void pokegen_spec_init(struct Spec *spec) {
+  struct Growth growth = {
+    .species = 1,
+    .held_item = 0,
+    .experience = 0,
+    .pp_bonus = (struct PPBonus) {
+      .move1 = 0,
+      .move2 = 0,
+      .move3 = 0,
+      .move4 = 0
+    },
+    .friendship = 0xff,
+    .unknown = 0,
+  };
+
+  struct Attacks attacks = {
+    .moves = {0, 0, 0, 0},
+    .pp = {0, 0, 0, 0}
+  };
+
+  struct Condition condition = {
+    .hp_ev = 0xff,
+    .attack_ev = 0xff,
+    .defense_ev = 0xff,
+    .speed_ev = 0xff,
+    .special_attack_ev = 0xff,
+    .special_defense_ev = 0xff,
+    .coolness = 0xff,
+    .beauty = 0xff,
+    .cuteness = 0xff,
+    .smartness = 0xff,
+    .toughness = 0xff,
+    .feel = 0,
+  };
+
+  struct Misc misc = {
+    .pokerus = (struct Pokerus) {
+      .days_remaining = 0x0,
+      .strain = 0x0,
+    },
+    .met_location = 0xff, // Fateful Encounter
+    .origins = (struct Origins) {
+      .level_met = 1,
+      .game_met = GAME_SAPPHIRE,
+      .pokeball_type = POKEBALL_STANDARD,
+      .trainer_gender = TRAINER_MALE
+    },
+    .ivs = (struct IVs) {
+      .hp = 0x1f,
+      .attack = 0x1f,
+      .defense = 0x1f,
+      .speed = 0x1f,
+      .special_attack = 0x1f,
+      .special_defense = 0x1f,
+      .egg = 0,
+      .ability = ABILITY_PRIMARY
+    },
+    .ribbons = 0
+  };
+
+  struct Pokemon pkmn = {
+    .language = 0x0202,
+    .markings = MARKING_BULLET,
+    .unknown = 0,
+    .status = 0,
+    .level = 1,
+    .pokerus = 0,
+    .current_health = 0xff,
+    .max_health = 0xff,
+    .attack = 0xff,
+    .defense = 0xff,
+    .speed = 0xff,
+    .special_attack = 0xff,
+    .special_defense = 0xff
+  };
+
+  *spec = (struct Spec) {
+    .pkmn = pkmn,
+    .growth = growth,
+    .attacks = attacks,
+    .condition = condition,
+    .misc = misc,
+    .personality_set = false,
+    .trainer_id_set = false,
+    .seed_set = false,
+    .seed = 0,
+    .frame = 1,
+    .method = METHOD_1,
+    .nickname = {0},
+    .trainer_name = {0},
+    .derive = DERIVE_ALL
+  };
+}
+
+// Set the field of spec selected by option character c from its argument
+// returns false if the argument is invalid or c isn't a pokémon field
+bool pokegen_spec_set(struct Spec *spec, int c, char *arg) {
+  char *save;
+  uint32_t n;
+
+  switch(c) {
+  case 's': // species; see bulbapedia:List_of_Pokémon_by_index_number_(Generation_III)
+    if(!index_parse(&species_table, "species", arg, &spec->growth.species)) return false;
+    break;
+  case 'i': // held item; see bulbapedia:List_of_items_by_index_number_(Generation_III)
+    if(!index_parse(&items_table, "item", arg, &spec->growth.held_item)) return false;
+    break;
+  case 'x': // experience
+    if(!field_parse("experience", arg, UINT32_MAX, &n)) return false;
+    spec->growth.experience = n;
+    spec->derive &= ~DERIVE_EXPERIENCE;
+    break;
+  case 'B': // pp bonuses
+    {
+      char *one = strtok_r(arg, ":", &save);
+      char *two = strtok_r(NULL, ":", &save);
+      char *three = strtok_r(NULL, ":", &save);
+      char *four = strtok_r(NULL, ":", &save);
+
+      if(four == NULL) {
+        complain("pp bonuses must be <a>:<b>:<c>:<d>");
+        return false;
+      }
+
+      uint32_t bonus[4];
+      if(!field_parse("pp bonus", one, FIELD_MASK(PP_BONUS_BITS), &bonus[0]) ||
+         !field_parse("pp bonus", two, FIELD_MASK(PP_BONUS_BITS), &bonus[1]) ||
+         !field_parse("pp bonus", three, FIELD_MASK(PP_BONUS_BITS), &bonus[2]) ||
+         !field_parse("pp bonus", four, FIELD_MASK(PP_BONUS_BITS), &bonus[3])) {
+        return false;
+      }
+      spec->growth.pp_bonus.move1 = (uint8_t) bonus[0];
+      spec->growth.pp_bonus.move2 = (uint8_t) bonus[1];
+      spec->growth.pp_bonus.move3 = (uint8_t) bonus[2];
+      spec->growth.pp_bonus.move4 = (uint8_t) bonus[3];
+    }
+    break;
+  case 'f': // friendship
+    if(!field_parse("friendship", arg, UINT8_MAX, &n)) return false;
+    spec->growth.friendship = (uint8_t) n;
+    break;
+  case 'm': // moves
+    {
+      char *one = strtok_r(arg, ":", &save);
+      char *two = strtok_r(NULL, ":", &save);
+      char *three = strtok_r(NULL, ":", &save);
+      char *four = strtok_r(NULL, ":", &save);
+
+      if(four == NULL) {
+        complain("moves must be <a>:<b>:<c>:<d>");
+        return false;
+      }
+
+      if(!index_parse(&moves_table, "move", one, &spec->attacks.moves[0]) ||
+         !index_parse(&moves_table, "move", two, &spec->attacks.moves[1]) ||
+         !index_parse(&moves_table, "move", three, &spec->attacks.moves[2]) ||
+         !index_parse(&moves_table, "move", four, &spec->attacks.moves[3])) {
+        return false;
+      }
+    }
+    break;
+  case 'P': // pp for moves
+    {
+      char *one = strtok_r(arg, ":", &save);
+      char *two = strtok_r(NULL, ":", &save);
+      char *three = strtok_r(NULL, ":", &save);
+      char *four = strtok_r(NULL, ":", &save);
+
+      if(four == NULL) {
+        complain("pp must be <a>:<b>:<c>:<d>");
+        return false;
+      }
+
+      uint32_t pp[4];
+      if(!field_parse("pp", one, UINT8_MAX, &pp[0]) ||
+         !field_parse("pp", two, UINT8_MAX, &pp[1]) ||
+         !field_parse("pp", three, UINT8_MAX, &pp[2]) ||
+         !field_parse("pp", four, UINT8_MAX, &pp[3])) {
+        return false;
+      }
+      for(size_t i = 0; i < 4; i++) spec->attacks.pp[i] = (uint8_t) pp[i];
+      spec->derive &= ~DERIVE_PP;
+    }
+    break;
+  case 'j': // hp ev
+    if(!field_parse("hp ev", arg, UINT8_MAX, &n)) return false;
+    spec->condition.hp_ev = (uint8_t) n;
+    break;
+  case 'v': // attack ev
+    if(!field_parse("attack ev", arg, UINT8_MAX, &n)) return false;
+    spec->condition.attack_ev = (uint8_t) n;
+    break;
+  case 'e': // defense ev
+    if(!field_parse("defense ev", arg, UINT8_MAX, &n)) return false;
+    spec->condition.defense_ev = (uint8_t) n;
+    break;
+  case 'V': // speed ev
+    if(!field_parse("speed ev", arg, UINT8_MAX, &n)) return false;
+    spec->condition.speed_ev = (uint8_t) n;
+    break;
+  case 'K': // special attack ev
+    if(!field_parse("special attack ev", arg, UINT8_MAX, &n)) return false;
+    spec->condition.special_attack_ev = (uint8_t) n;
+    break;
+  case 'E': // special defense ev
+    if(!field_parse("special defense ev", arg, UINT8_MAX, &n)) return false;
+    spec->condition.special_defense_ev = (uint8_t) n;
+    break;
+  case 'c': // coolness
+    if(!field_parse("coolness", arg, UINT8_MAX, &n)) return false;
+    spec->condition.coolness = (uint8_t) n;
+    break;
+  case 'y': // beauty
+    if(!field_parse("beauty", arg, UINT8_MAX, &n)) return false;
+    spec->condition.beauty = (uint8_t) n;
+    break;
+  case 'C': // cuteness
+    if(!field_parse("cuteness", arg, UINT8_MAX, &n)) return false;
+    spec->condition.cuteness = (uint8_t) n;
+    break;
+  case 'r': // smartness
+    if(!field_parse("smartness", arg, UINT8_MAX, &n)) return false;
+    spec->condition.smartness = (uint8_t) n;
+    break;
+  case 'T': // toughness
+    if(!field_parse("toughness", arg, UINT8_MAX, &n)) return false;
+    spec->condition.toughness = (uint8_t) n;
+    break;
+  case 'F': // feel
+    if(!field_parse("feel", arg, UINT8_MAX, &n)) return false;
+    spec->condition.feel = (uint8_t) n;
+    break;
+  case 'R': // pokérus (days remaining:strain)
+    {
+      char *days = strtok_r(arg, ":", &save);
+      char *strain = strtok_r(NULL, ":", &save);
+
+      if(strain == NULL) {
+        complain("pokerus must be <days remaining>:<strain>");
+        return false;
+      }
+
+      if(!field_parse("pokerus days remaining", days, FIELD_MASK(POKERUS_BITS), &n)) return false;
+      spec->misc.pokerus.days_remaining = (uint8_t) n;
+      if(!field_parse("pokerus strain", strain, FIELD_MASK(POKERUS_BITS), &n)) return false;
+      spec->misc.pokerus.strain = (uint8_t) n;
+    }
+    break;
+  case 'k': // location met at; see bulbapedia:List_of_locations_by_index_number_(Generation_III)
+    {
+      uint16_t location;
+      if(!index_parse(&locations_table, "location", arg, &location)) return false;
+      spec->misc.met_location = (uint8_t) location;
+    }
+    break;
+  case 'M': // level met at
+    if(!field_parse("level met", arg, FIELD_MASK(LEVEL_MET_BITS), &n)) return false;
+    spec->misc.origins.level_met = (uint8_t) n;
+    break;
+  case 'G': // game met in
+    {
+      uint16_t game;
+      if(!name_lookup(&games_table, arg, &game)) {
+        complain("game must be one of colosseum-bonus|sapphire|ruby|emerald|"
+                 "firered|leafgreen|colosseum-xd");
+        return false;
+      }
+      spec->misc.origins.game_met = (uint8_t) (game & FIELD_MASK(GAME_MET_BITS));
+    }
+    break;
+  case 'b': // pokeball used
+    {
+      uint16_t ball;
+      if(!name_lookup(&balls_table, arg, &ball)) {
+        complain("pokeball must be one of master|ultra|great|standard|safari|"
+                 "net|dive|nest|repeat|timer|luxury|premier");
+        return false;
+      }
+      spec->misc.origins.pokeball_type = (uint8_t) (ball & FIELD_MASK(POKEBALL_TYPE_BITS));
+    }
+    break;
+  case 'H': // hp iv
+    if(!field_parse("hp iv", arg, FIELD_MASK(IV_BITS), &n)) return false;
+    spec->misc.ivs.hp = (uint8_t) n;
+    break;
+  case 'a': // attack iv
+    if(!field_parse("attack iv", arg, FIELD_MASK(IV_BITS), &n)) return false;
+    spec->misc.ivs.attack = (uint8_t) n;
+    break;
+  case 'd': // defense iv
+    if(!field_parse("defense iv", arg, FIELD_MASK(IV_BITS), &n)) return false;
+    spec->misc.ivs.defense = (uint8_t) n;
+    break;
+  case 'S': // speed iv
+    if(!field_parse("speed iv", arg, FIELD_MASK(IV_BITS), &n)) return false;
+    spec->misc.ivs.speed = (uint8_t) n;
+    break;
+  case 'A': // special attack iv
+    if(!field_parse("special attack iv", arg, FIELD_MASK(IV_BITS), &n)) return false;
+    spec->misc.ivs.special_attack = (uint8_t) n;
+    break;
+  case 'D': // special defense iv
+    if(!field_parse("special defense iv", arg, FIELD_MASK(IV_BITS), &n)) return false;
+    spec->misc.ivs.special_defense = (uint8_t) n;
+    break;
+  case 'g': // is an egg?
+    {
+      spec->misc.ivs.egg = 1;
+      spec->pkmn.language = LANGUAGE_EGG;
+    }
+    break;
+  case '1': // use primary ability (default)
+    spec->misc.ivs.ability = ABILITY_PRIMARY;
+    break;
+  case '2': // use secondary ability
+    spec->misc.ivs.ability = ABILITY_SECONDARY;
+    break;
+  case 'p': // personality
+    if(!field_parse("personality", arg, UINT32_MAX, &n)) return false;
+    spec->pkmn.personality = n;
+    spec->personality_set = true;
+    break;
+  case 't': // trainer id:trainer gender
+    {
+      char *tid = strtok_r(arg, ":", &save);
+      char *gender = strtok_r(NULL, ":", &save);
+
+      if(gender == NULL) {
+        complain("trainer must be <trainer id>:<male|female>");
+        return false;
+      }
+
+      if(!field_parse("trainer id", tid, UINT32_MAX, &n)) return false;
+      spec->pkmn.trainer_id = n;
+      spec->trainer_id_set = true;
+
+      if(!strcmp(gender, "male")) {
+        spec->misc.origins.trainer_gender = TRAINER_MALE;
+      } else if(!strcmp(gender, "female")) {
+        spec->misc.origins.trainer_gender = TRAINER_FEMALE;
+      } else {
+        complain("gender must be 'male' or 'female'");
+        return false;
+      }
+    }
+    break;
+  case 'N': // language met in
+    {
+      // an egg's language is fixed, so one given for it is disregarded
+      if(!spec->misc.ivs.egg && spec->pkmn.language != LANGUAGE_EGG &&
+         !name_lookup(&languages_table, arg, &spec->pkmn.language)) {
+        complain("language must be one of ja|en|fr|it|de|ko|es");
+        return false;
+      }
+    }
+    break;
+  case 'l': // pokemon level (recalculated on game save/load)
+    if(!field_parse("level", arg, UINT8_MAX, &n)) return false;
+    spec->pkmn.level = (uint8_t) n;
+    spec->derive &= ~DERIVE_LEVEL;
+    break;
+  case 'Y': // pokérus remaining cache
+    if(!field_parse("pokerus remaining", arg, UINT8_MAX, &n)) return false;
+    spec->pkmn.pokerus = (uint8_t) n;
+    break;
+  case 'L': // current health
+    if(!field_parse("current health", arg, UINT16_MAX, &n)) return false;
+    spec->pkmn.current_health = (uint16_t) n;
+    spec->derive &= ~DERIVE_HP;
+    break;
+  case 'n': // max health cache
+    if(!field_parse("max health", arg, UINT16_MAX, &n)) return false;
+    spec->pkmn.max_health = (uint16_t) n;
+    spec->derive &= ~DERIVE_MAX_HP;
+    break;
+  case 'q': // attack cache
+    if(!field_parse("attack", arg, UINT16_MAX, &n)) return false;
+    spec->pkmn.attack = (uint16_t) n;
+    spec->derive &= ~DERIVE_ATTACK;
+    break;
+  case 'u': // defense cache
+    if(!field_parse("defense", arg, UINT16_MAX, &n)) return false;
+    spec->pkmn.defense = (uint16_t) n;
+    spec->derive &= ~DERIVE_DEFENSE;
+    break;
+  case 'I': // speed cache
+    if(!field_parse("speed", arg, UINT16_MAX, &n)) return false;
+    spec->pkmn.speed = (uint16_t) n;
+    spec->derive &= ~DERIVE_SPEED;
+    break;
+  case 'Q': // special attack cache
+    if(!field_parse("special attack", arg, UINT16_MAX, &n)) return false;
+    spec->pkmn.special_attack = (uint16_t) n;
+    spec->derive &= ~DERIVE_SPECIAL_ATTACK;
+    break;
+  case 'U': // special defense cache
+    if(!field_parse("special defense", arg, UINT16_MAX, &n)) return false;
+    spec->pkmn.special_defense = (uint16_t) n;
+    spec->derive &= ~DERIVE_SPECIAL_DEFENSE;
+    break;
+  case OPT_SEED: // rng seed
+    if(!field_parse("seed", arg, UINT32_MAX, &n)) return false;
+    spec->seed = n;
+    spec->seed_set = true;
+    break;
+  case OPT_FRAME: // rng frame
+    if(!field_parse("frame", arg, UINT32_MAX, &n)) return false;
+    if(n == 0) {
+      complain("frame must be at least 1");
+      return false;
+    }
+    spec->frame = n;
+    break;
+  case OPT_METHOD: // rng method
+    if(!number_parse(arg, METHOD_4, &n) || (n != METHOD_1 && n != METHOD_2 && n != METHOD_4)) {
+      complain("method must be 1, 2 or 4");
+      return false;
+    }
+    spec->method = (uint8_t) n;
+    break;
+  default:
+    return false;
+  }
+
+  return true;
+}
+
+// Next number from a splitmix64 generator, whose state is owned by the caller
+uint32_t pokegen_random(uint64_t *state) {
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return (uint32_t) ((z ^ (z >> 31)) >> 32);
+}
+
+// Build spec into dest, with data assembled but not encrypted, and stat set to
+// its calculated stats if it derives any; with a template, names and stats
+// that are the same as the template's are copied instead
+// returns false (after complaining) if either name can't be represented in
+// its language
+static bool build_from(const struct Template *t, const struct Spec *spec, uint64_t *rng,
+                       struct Pokemon *dest, int32_t stat[STATS]) {
+  *dest = spec->pkmn;
+
+  struct Misc misc = spec->misc;
+
+  if(spec->seed_set) {
+    pokegen_lcg_generate(spec->seed, spec->frame, spec->method, &dest->personality, &misc.ivs);
+  } else if(!spec->personality_set) {
+    dest->personality = pokegen_random(rng);
+  }
+  if(!spec->trainer_id_set) dest->trainer_id = pokegen_random(rng);
+
+  bool same_language = t != NULL && dest->language == t->built.language;
+  if(same_language && !strcmp(spec->nickname, t->nickname)) {
+    memcpy(dest->nickname, t->built.nickname, NICKNAME_LENGTH);
+  } else if(!pcs_encode(dest->nickname, NICKNAME_LENGTH, spec->nickname,
+                        sizeof(spec->nickname), dest->language)) {
+    complain("nickname contains characters that can't be converted");
+    return false;
+  }
+
+  if(same_language && !strcmp(spec->trainer_name, t->trainer_name)) {
+    memcpy(dest->trainer_name, t->built.trainer_name, TRAINER_NAME_LENGTH);
+  } else if(!pcs_encode(dest->trainer_name, TRAINER_NAME_LENGTH, spec->trainer_name,
+                        sizeof(spec->trainer_name), dest->language)) {
+    complain("trainer name contains characters that can't be converted");
+    return false;
+  }
+
+  struct Growth growth = spec->growth;
+  struct Attacks attacks = spec->attacks;
+  derive_growth(spec->derive, dest, &growth, &attacks);
+
+  data_assemble_to(
+    dest->data,
+    dest->personality,
+    &growth,
+    &attacks,
+    &spec->condition,
+    &misc
+  );
+
+  if(spec->derive & (DERIVE_STATS | DERIVE_HP)) {
+    // Stats follow from the species, level, nature, IVs (in misc) and EVs
+    // (in condition)
+    const uint8_t *offset = datum_offset[dest->personality % DATUM_ORDERS];
+    if(t != NULL && t->stats_valid && growth.species == t->species &&
+       dest->level == t->built.level && dest->personality == t->built.personality &&
+       !memcmp(dest->data + offset[DATUM_CONDITION],
+               t->built.data + offset[DATUM_CONDITION], DATUM_LENGTH) &&
+       !memcmp(dest->data + offset[DATUM_MISC],
+               t->built.data + offset[DATUM_MISC], DATUM_LENGTH)) {
+      memcpy(stat, t->stat, sizeof(t->stat));
+    } else {
+      struct StatTerms terms;
+      stat_terms(&terms, 0, growth.species, dest->level, dest->personality,
+                 &misc.ivs, &spec->condition);
+      stats_calculate(&terms, STATS);
+      memcpy(stat, terms.stat, STATS * sizeof(*stat));
+    }
+    stats_store(dest, stat, growth.species, spec->derive);
+  }
+  return true;
+}
+
+// Convert spec into a complete pokémon, but with data not yet encrypted
+// returns false if either name can't be represented in its language
+// Unset personalities and trainer IDs are drawn from rng
+bool pokegen_build(const struct Spec *spec, uint64_t *rng, struct Pokemon *dest) {
+  int32_t stat[STATS];
+  return build_from(NULL, spec, rng, dest, stat);
+}
+
+// Decrypt a complete pokémon back into a spec that would build it
+// Names are decoded into spec->nickname and spec->trainer_name, or left empty
+// if they can't be
+// returns false if the pokémon's checksum doesn't match its data
+bool pokegen_decode(struct Spec *spec, const struct Pokemon *src) {
+  *spec = (struct Spec) {
+    .pkmn = *src,
+    .personality_set = true,
+    .trainer_id_set = true,
+    .seed_set = false,
+    .seed = 0,
+    .frame = 1,
+    .method = METHOD_1,
+    .nickname = {0},
+    .trainer_name = {0},
+    .derive = 0 // keep every field as it was
+  };
+  const struct Pokemon *pkmn = &spec->pkmn;
+  record_byte_order((uint8_t *) &spec->pkmn, sizeof(struct Pokemon));
+
+  pcs_decode(spec->nickname, sizeof(spec->nickname), pkmn->nickname,
+             NICKNAME_LENGTH, pkmn->language);
+  pcs_decode(spec->trainer_name, sizeof(spec->trainer_name), pkmn->trainer_name,
+             TRAINER_NAME_LENGTH, pkmn->language);
+
+  return data_decrypt_from(
+    pkmn->data,
+    pkmn->personality,
+    pkmn->trainer_id,
+    pkmn->checksum,
+    &spec->growth,
+    &spec->attacks,
+    &spec->condition,
+    &spec->misc
+  );
+}
+
+/* Templates */
+
+// Build and encode spec as a template to stamp variants of
+// returns false if either name can't be represented in its language
+// Unset personalities and trainer IDs are drawn from rng
+bool pokegen_template_build(struct Template *t, const struct Spec *spec, uint64_t *rng) {
+  if(!build_from(NULL, spec, rng, &t->built, t->stat)) return false;
+
+  const uint8_t *offset = datum_offset[t->built.personality % DATUM_ORDERS];
+  t->species = load16(t->built.data + offset[DATUM_GROWTH]);
+  t->stats_valid = (spec->derive & (DERIVE_STATS | DERIVE_HP)) != 0;
+  t->checksum = data_checksum(t->built.data, DATA_LENGTH);
+  memcpy(t->nickname, spec->nickname, sizeof(t->nickname));
+  memcpy(t->trainer_name, spec->trainer_name, sizeof(t->trainer_name));
+
+  t->pkmn = t->built;
+  pokegen_encode(&t->pkmn, 1);
+  return true;
+}
+
+// Build spec, a variant of t, into dest and encode it; only the parts that
+// differ from t are converted, calculated and encrypted again
+// returns false if either name can't be represented in its language
+// Unset personalities and trainer IDs are drawn from rng
+bool pokegen_template_stamp(const struct Template *t, const struct Spec *spec, uint64_t *rng,
+                            struct Pokemon *dest) {
+  int32_t stat[STATS];
+  if(!build_from(t, spec, rng, dest, stat)) return false;
+
+  uint32_t key = dest->personality ^ dest->trainer_id;
+  if(dest->personality != t->built.personality || dest->trainer_id != t->built.trainer_id) {
+    // a different order and key, so nothing of t's data can be reused
+    dest->checksum = data_checksum(dest->data, DATA_LENGTH);
+    data_crypt(dest->data, DATA_LENGTH, key);
+  } else {
+    // The checksum is a sum, so it changes by however much each datum's does
+    uint16_t cksum = t->checksum;
+    for(size_t i = 0; i < DATA_LENGTH; i += DATUM_LENGTH) {
+      if(!memcmp(dest->data + i, t->built.data + i, DATUM_LENGTH)) {
+        memcpy(dest->data + i, t->pkmn.data + i, DATUM_LENGTH);
+        continue;
+      }
+      cksum += (uint16_t) (data_checksum(dest->data + i, DATUM_LENGTH) -
+                           data_checksum(t->built.data + i, DATUM_LENGTH));
+      data_crypt(dest->data + i, DATUM_LENGTH, key);
+    }
+    dest->checksum = cksum;
+  }
+
+  record_byte_order((uint8_t *) dest, sizeof(struct Pokemon));
+  return true;
+}
+
+/* Generation Ⅲ save files
+ * A save file holds two save blocks, each of 14 sections which may be stored
+ * in any order. The block with the greater save index is the current one. */
+// Length of the checksummed part of each section, indexed by section ID
+static const uint16_t section_length[SECTIONS_PER_BLOCK] = {
+  3884, 3968, 3968, 3968, 3848, 3968, 3968,
+  3968, 3968, 3968, 3968, 3968, 3968, 2000
+};
+
+// Checksum the first len bytes of a section
+static uint16_t section_checksum(const uint8_t *section, size_t len) {
+  uint32_t sum = 0;
+  for(size_t i = 0; i < len; i += sizeof(uint32_t)) {
+    sum += load32(section + i);
+  }
+  return (uint16_t) ((sum >> 16) + sum);
+}
+
+// Recompute the stored checksum of each section written to since the last update
+static void save_update_checksums(struct Save *save) {
+  for(unsigned id = 0; id < SECTIONS_PER_BLOCK; id++) {
+    if(save->dirty & (1 << id)) {
+      store16(save->section[id] + SECTION_CHECKSUM_OFFSET,
+              section_checksum(save->section[id], section_length[id]));
+    }
+  }
+  save->dirty = 0;
+}
+
+// Map a save file, to write into if writable, and locate its current save block
+// returns false (after complaining) if path isn't a valid save file
+bool pokegen_save_open(struct Save *save, const char *path, bool writable) {
+  int fd = open(path, writable ? O_RDWR : O_RDONLY);
+  struct stat st;
+
+  if(fd < 0 || fstat(fd, &st) < 0) {
+    complain("%s: %s", path, strerror(errno));
+    if(fd >= 0) close(fd);
+    return false;
+  } else if(st.st_size < SAVE_BLOCKS * SAVE_BLOCK_SIZE) {
+    complain("%s: too small to be a save file", path);
+    close(fd);
+    return false;
+  }
+
+  save->size = (size_t) st.st_size;
+  save->dirty = 0;
+  save->map = mmap(NULL, save->size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                   writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(save->map == MAP_FAILED) {
+    complain("%s: %s", path, strerror(errno));
+    return false;
+  }
+
+  // Find the block with the latest save index whose sections are all present
+  bool found = false;
+  uint32_t latest = 0;
+  for(size_t block = 0; block < SAVE_BLOCKS; block++) {
+    uint8_t *base = save->map + (block * SAVE_BLOCK_SIZE);
+    uint8_t *section[SECTIONS_PER_BLOCK] = {NULL};
+    uint32_t index = load32(base + SECTION_INDEX_OFFSET);
+    bool complete = true;
+
+    for(size_t i = 0; i < SECTIONS_PER_BLOCK; i++) {
+      uint8_t *s = base + (i * SECTION_SIZE);
+      uint16_t id = load16(s + SECTION_ID_OFFSET);
+
+      if(load32(s + SECTION_SIGNATURE_OFFSET) != SECTION_SIGNATURE ||
+         load32(s + SECTION_INDEX_OFFSET) != index ||
+         id >= SECTIONS_PER_BLOCK || section[id] != NULL) {
+        complete = false;
+        break;
+      }
+      section[id] = s;
+    }
+
+    if(complete && (!found || (int32_t) (index - latest) > 0)) {
+      memcpy(save->section, section, sizeof(section));
+      latest = index;
+      found = true;
+    }
+  }
+
+  if(!found) {
+    complain("%s: no valid save block", path);
+    munmap(save->map, save->size);
+    return false;
+  }
+
+  if(load32(save->section[SECTION_TRAINER] + TRAINER_GAME_CODE_OFFSET) == GAME_CODE_FRLG) {
+    save->team_size_offset = TEAM_SIZE_OFFSET_FRLG;
+  } else {
+    save->team_size_offset = TEAM_SIZE_OFFSET_RSE;
+  }
+  return true;
+}
+
+// Update checksums, then flush and unmap a save file
+// returns false (after complaining) if the changes couldn't be written back;
+// the save is closed either way
+bool pokegen_save_close(struct Save *save) {
+  bool ok = true;
+
+  save_update_checksums(save);
+  if(msync(save->map, save->size, MS_SYNC) != 0) {
+    complain("save: %s", strerror(errno));
+    ok = false;
+  }
+  munmap(save->map, save->size);
+  return ok;
+}
+
+// Copy len bytes to offset within the PC buffer, which spans sections 5-13
+static void save_pc_write(struct Save *save, size_t offset, const void *src, size_t len) {
+  const uint8_t *_src = (const uint8_t *) src;
+
+  while(len > 0) {
+    size_t id = SECTION_PC + (offset / SECTION_DATA_SIZE);
+    size_t within = offset % SECTION_DATA_SIZE;
+    size_t n = SECTION_DATA_SIZE - within;
+    if(n > len) n = len;
+
+    memcpy(save->section[id] + within, _src, n);
+    save->dirty |= (uint16_t) (1 << id);
+    _src += n;
+    offset += n;
+    len -= n;
+  }
+}
+
+// Copy len bytes from offset within the PC buffer
+static void save_pc_read(const struct Save *save, size_t offset, void *dest, size_t len) {
+  uint8_t *_dest = (uint8_t *) dest;
+
+  while(len > 0) {
+    size_t id = SECTION_PC + (offset / SECTION_DATA_SIZE);
+    size_t within = offset % SECTION_DATA_SIZE;
+    size_t n = SECTION_DATA_SIZE - within;
+    if(n > len) n = len;
+
+    memcpy(_dest, save->section[id] + within, n);
+    _dest += n;
+    offset += n;
+    len -= n;
+  }
+}
+
+// Read the pokémon in a party or PC box slot; a box pokémon has no party
+// fields, so they're zeroed
+// returns false if the slot doesn't exist or is empty
+bool pokegen_save_read(const struct Save *save, struct SaveSlot slot, struct Pokemon *pkmn) {
+  memset(pkmn, 0, sizeof(*pkmn));
+  if(slot.box) {
+    if(slot.index >= BOXES * BOX_SIZE) return false;
+
+    save_pc_read(save, PC_POKEMON_OFFSET + (slot.index * BOX_POKEMON_LENGTH),
+                 pkmn, BOX_POKEMON_LENGTH);
+  } else {
+    const uint8_t *team = save->section[SECTION_TEAM] + save->team_size_offset;
+    if(slot.index >= PARTY_SIZE || slot.index >= load32(team)) return false;
+
+    memcpy(pkmn, team + sizeof(uint32_t) + (slot.index * sizeof(struct Pokemon)),
+           sizeof(struct Pokemon));
+  }
+
+  // an empty slot is all zeroes, with no personality or trainer to key it
+  const uint8_t *record = (const uint8_t *) pkmn;
+  for(size_t i = 0; i < BOX_POKEMON_LENGTH; i++) {
+    if(record[i] != 0) return true;
+  }
+  return false;
+}
+
+// Write a pokémon into a party or PC box slot
+// Section checksums are updated when the save is closed
+// returns false if the slot doesn't exist
+bool pokegen_save_write(struct Save *save, struct SaveSlot slot, const struct Pokemon *pkmn) {
+  if(slot.box) {
+    if(slot.index >= BOXES * BOX_SIZE) return false;
+
+    save_pc_write(save, PC_POKEMON_OFFSET + (slot.index * BOX_POKEMON_LENGTH),
+                  pkmn, BOX_POKEMON_LENGTH);
+  } else {
+    if(slot.index >= PARTY_SIZE) return false;
+
+    uint8_t *team = save->section[SECTION_TEAM] + save->team_size_offset;
+    memcpy(team + sizeof(uint32_t) + (slot.index * sizeof(struct Pokemon)),
+           pkmn, sizeof(struct Pokemon));
+    if(load32(team) <= slot.index) {
+      store32(team, (uint32_t) (slot.index + 1));
+    }
+    save->dirty |= 1 << SECTION_TEAM;
+  }
+
+  return true;
+}
+
+// Write n assembled, not yet encrypted, pokémon into consecutive PC slots
+// starting at index, encrypting them in place in the save
+// returns the number written, which is less than n if the PC fills up
+size_t pokegen_save_write_boxes(struct Save *save, size_t index, struct Pokemon *pkmn, size_t n) {
+  if(index >= BOXES * BOX_SIZE) return 0;
+  if(n > (BOXES * BOX_SIZE) - index) n = (BOXES * BOX_SIZE) - index;
+
+  for(size_t i = 0; i < n;) {
+    size_t offset = PC_POKEMON_OFFSET + ((index + i) * BOX_POKEMON_LENGTH);
+    size_t id = SECTION_PC + (offset / SECTION_DATA_SIZE);
+    size_t within = offset % SECTION_DATA_SIZE;
+
+    if(within + BOX_POKEMON_LENGTH > SECTION_DATA_SIZE) {
+      // split across two sections, so encrypt it before copying
+      pokegen_encode(&pkmn[i], 1);
+      save_pc_write(save, offset, &pkmn[i], BOX_POKEMON_LENGTH);
+      i++;
+      continue;
+    }
+
+    // a run of slots within this section
+    size_t run = (SECTION_DATA_SIZE - within) / BOX_POKEMON_LENGTH;
+    if(run > n - i) run = n - i;
+
+    uint8_t *dest = save->section[id] + within;
+    for(size_t j = 0; j < run; j++) {
+      memcpy(dest + (j * BOX_POKEMON_LENGTH), &pkmn[i + j], BOX_POKEMON_LENGTH);
+    }
+    data_encrypt_records(dest, BOX_POKEMON_LENGTH, run);
+    save->dirty |= (uint16_t) (1 << id);
+    i += run;
+  }
+
+  return n;
+}
+
+// Parse a slot of the form party:<1-6> or box:<1-14>:<1-30>
+// returns false if it isn't one
+bool pokegen_save_slot_parse(struct SaveSlot *slot, const char *arg) {
+  unsigned box, index;
+  char end;
+
+  if(sscanf(arg, "party:%u%c", &index, &end) == 1 &&
+     index >= 1 && index <= PARTY_SIZE) {
+    *slot = (struct SaveSlot) {.box = false, .index = index - 1};
+    return true;
+  } else if(sscanf(arg, "box:%u:%u%c", &box, &index, &end) == 2 &&
+            box >= 1 && box <= BOXES && index >= 1 && index <= BOX_SIZE) {
+    *slot = (struct SaveSlot) {.box = true, .index = ((box - 1) * BOX_SIZE) + index - 1};
+    return true;
+  }
+  return false;
+}
+
+/* Personality value search
+ * The personality alone decides a pokémon's nature, gender, ability slot,
+ * shininess (with its trainer ID) and the order of its data. */
+#define PID_CHUNK_BITS 20
+#define PID_CHUNK_SIZE (1UL << PID_CHUNK_BITS)
+#define PID_CHUNKS (1UL << (32 - PID_CHUNK_BITS))
+#define PID_BLOCK 4096
+static const char *const nature_names[NATURES] = {
+  "hardy", "lonely", "brave", "adamant", "naughty",
+  "bold", "docile", "relaxed", "impish", "lax",
+  "timid", "hasty", "serious", "jolly", "naive",
+  "modest", "mild", "quiet", "bashful", "rash",
+  "calm", "gentle", "sassy", "careful", "quirky"
+};
+
+struct PidSearch {
+  const struct PidQuery *query;
+  unsigned long limit; // stop after this many matches, unless 0
+  atomic_ulong next_chunk;
+  atomic_bool stop;
+  pthread_mutex_t lock;
+  pthread_cond_t committed;
+  unsigned long commit_chunk; // matches are output in chunk order
+  unsigned long found;
+  bool failed;
+  FILE *out;
+};
+
+// Set match[i] to whether base + i satisfies query, for a block of personalities
+// Branch free, so it vectorises
+#ifdef HAVE_X86_SIMD
+__attribute__((target_clones("avx2", "default")))
+#endif
+static void pid_match_block(const struct PidQuery *q, uint32_t base, uint8_t *match) {
+  // copied out of q, so the compiler knows match can't change them
+  const bool any_nature = !q->nature_set, any_order = !q->order_set;
+  const bool any_ability = !q->ability_set, any_gender = !q->gender_set;
+  const bool any_shiny = !q->shiny_set, female = q->female, shiny = q->shiny;
+  const uint32_t nature = q->nature, order = q->order, ability = q->ability;
+  const uint32_t threshold = q->gender_threshold;
+  const uint32_t tsv = (q->trainer_id >> 16) ^ (q->trainer_id & 0xffff);
+
+  for(uint32_t i = 0; i < PID_BLOCK; i++) {
+    uint32_t pid = base + i;
+    uint32_t psv = (pid >> 16) ^ (pid & 0xffff);
+
+    match[i] = (uint8_t) (
+      (any_nature | ((pid % NATURES) == nature)) &
+      (any_order | ((pid % DATUM_ORDERS) == order)) &
+      (any_ability | ((pid & 1) == ability)) &
+      (any_gender | (((pid & 0xff) < threshold) == female)) &
+      (any_shiny | (((psv ^ tsv) < 8) == shiny))
+    );
+  }
+}
+
+// Output the matches of a chunk once all earlier chunks have been output
+// returns false if the search is over
+static bool pid_search_commit(struct PidSearch *search, unsigned long chunk,
+                              const uint32_t *hits, size_t n) {
+  pthread_mutex_lock(&search->lock);
+  while(search->commit_chunk != chunk && !atomic_load(&search->stop)) {
+    pthread_cond_wait(&search->committed, &search->lock);
+  }
+
+  if(!atomic_load(&search->stop)) {
+    if(search->limit != 0 && n > search->limit - search->found) {
+      n = search->limit - search->found;
+    }
+    for(size_t i = 0; i < n; i++) {
+      fprintf(search->out, "%lu\n", (unsigned long) hits[i]);
+    }
+    search->found += n;
+
+    search->commit_chunk++;
+    if(search->commit_chunk == PID_CHUNKS ||
+       (search->limit != 0 && search->found >= search->limit)) {
+      atomic_store(&search->stop, true);
+    }
+  }
+
+  pthread_cond_broadcast(&search->committed);
+  pthread_mutex_unlock(&search->lock);
+  return !atomic_load(&search->stop);
+}
+
+// Worker thread; claims chunks of the personality space until none are left
+static void *pid_search_worker(void *arg) {
+  struct PidSearch *search = (struct PidSearch *) arg;
+  uint32_t *hits = malloc(PID_CHUNK_SIZE * sizeof(uint32_t));
+  uint8_t match[PID_BLOCK];
+
+  if(hits == NULL) {
+    pthread_mutex_lock(&search->lock);
+    search->failed = true;
+    atomic_store(&search->stop, true);
+    pthread_cond_broadcast(&search->committed);
+    pthread_mutex_unlock(&search->lock);
+    return NULL;
+  }
+
+  for(;;) {
+    unsigned long chunk = atomic_fetch_add(&search->next_chunk, 1);
+    if(chunk >= PID_CHUNKS || atomic_load(&search->stop)) break;
+
+    size_t n = 0;
+    for(unsigned long block = 0; block < PID_CHUNK_SIZE; block += PID_BLOCK) {
+      uint32_t base = (uint32_t) ((chunk << PID_CHUNK_BITS) + block);
+
+      pid_match_block(search->query, base, match);
+
+      // matches are usually sparse, so skip eight at a time where there are none
+      for(uint32_t i = 0; i < PID_BLOCK; i += sizeof(uint64_t)) {
+        uint64_t any;
+        memcpy(&any, match + i, sizeof(any));
+        if(any == 0) continue;
+
+        for(uint32_t j = i; j < i + sizeof(uint64_t); j++) {
+          hits[n] = base + j;
+          n += match[j];
+        }
+      }
+    }
+
+    if(!pid_search_commit(search, chunk, hits, n)) break;
+  }
+
+  free(hits);
+  return NULL;
+}
+
+// Output, in increasing order, every personality satisfying query (or the
+// first limit of them, unless limit is 0), searching with threads threads,
+// and set found to how many were output
+// returns false (after complaining) if the search couldn't be finished
+bool pokegen_pid_search(const struct PidQuery *query, unsigned long limit,
+                        unsigned threads, FILE *out, unsigned long *found) {
+  struct PidSearch search = {
+    .query = query,
+    .limit = limit,
+    .commit_chunk = 0,
+    .found = 0,
+    .failed = false,
+    .out = out
+  };
+  pthread_t *pool = calloc(threads, sizeof(pthread_t));
+
+  atomic_init(&search.next_chunk, 0);
+  atomic_init(&search.stop, false);
+  pthread_mutex_init(&search.lock, NULL);
+  pthread_cond_init(&search.committed, NULL);
+
+  unsigned started = 0;
+  for(; pool != NULL && started < threads; started++) {
+    if(pthread_create(&pool[started], NULL, pid_search_worker, &search) != 0) break;
+  }
+  if(started == 0) pid_search_worker(&search);
+  for(unsigned i = 0; i < started; i++) {
+    pthread_join(pool[i], NULL);
+  }
+
+  pthread_cond_destroy(&search.committed);
+  pthread_mutex_destroy(&search.lock);
+  free(pool);
+  *found = search.found;
+  // a worker's error is its own thread's, so it's reported from this one
+  if(search.failed) complain("find-pid: %s", strerror(ENOMEM));
+  return !search.failed;
+}
+
+// Parse a comma separated list of constraints into query
+// returns false (after complaining) if any is invalid
+bool pokegen_pid_query_parse(struct PidQuery *query, char *arg) {
+  char *save = NULL;
+
+  for(char *c = strtok_r(arg, ",", &save); c != NULL; c = strtok_r(NULL, ",", &save)) {
+    char *value = strchr(c, '=');
+    if(value != NULL) *value++ = '\0';
+
+    if(!strcmp(c, "nature") && value != NULL) {
+      query->nature_set = true;
+      query->nature = NATURES;
+      for(uint8_t i = 0; i < NATURES; i++) {
+        if(!strcasecmp(value, nature_names[i])) query->nature = i;
+      }
+      uint32_t n = query->nature;
+      if(query->nature == NATURES && number_parse(value, NATURES - 1, &n)) {
+        query->nature = (uint8_t) n;
+      }
+      if(query->nature >= NATURES) {
+        complain("nature must be a nature's name or 0-24");
+        return false;
+      }
+    } else if(!strcmp(c, "order") && value != NULL) {
+      uint32_t n;
+      query->order_set = true;
+      if(!number_parse(value, DATUM_ORDERS - 1, &n)) {
+        complain("order must be between 0-23");
+        return false;
+      }
+      query->order = (uint8_t) n;
+    } else if(!strcmp(c, "ability") && value != NULL) {
+      query->ability_set = true;
+      if(!strcmp(value, "primary")) {
+        query->ability = ABILITY_PRIMARY;
+      } else if(!strcmp(value, "secondary")) {
+        query->ability = ABILITY_SECONDARY;
+      } else {
+        complain("ability must be 'primary' or 'secondary'");
+        return false;
+      }
+    } else if(!strcmp(c, "gender") && value != NULL) {
+      char *threshold = strchr(value, ':');
+      uint32_t n;
+      if(threshold != NULL) *threshold++ = '\0';
+
+      query->gender_set = true;
+      query->female = !strcmp(value, "female");
+      if(threshold == NULL || (!query->female && strcmp(value, "male")) ||
+         !number_parse(threshold, UINT8_MAX, &n)) {
+        complain("gender must be <male|female>:<species gender threshold 0-255>");
+        return false;
+      }
+      query->gender_threshold = (uint8_t) n;
+    } else if(!strcmp(c, "shiny")) {
+      query->shiny_set = true;
+      query->shiny = value == NULL || !strcmp(value, "yes");
+      if(value != NULL && !query->shiny && strcmp(value, "no")) {
+        complain("shiny must be 'yes' or 'no'");
+        return false;
+      }
+    } else {
+      complain("unknown personality constraint '%s'", c);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* Memory dump scanning
+ * Every byte offset of a dump is a candidate record: its data, decrypted with
+ * the key its personality and trainer ID make, must match its checksum, and
+ * then name a species. Workers take chunks of offsets in turn; a record can
+ * start near the end of a chunk and run into the next. */
+#define SCAN_CHUNK_SIZE (1UL << 20)
+
+struct Scan {
+  const uint8_t *dump;
+  size_t len;
+  atomic_size_t next_chunk;
+  pthread_mutex_t lock;
+  size_t *hits;
+  size_t found;
+  size_t capacity;
+  bool failed;
+};
+
+// Whether the record at p, whose checksum matches, is a species
+static bool scan_species(const uint8_t *p) {
+  uint32_t personality = load32(p + offsetof(struct Pokemon, personality));
+  uint32_t key = personality ^ load32(p + offsetof(struct Pokemon, trainer_id));
+  const uint8_t *growth = p + RECORD_DATA + datum_offset[personality % DATUM_ORDERS][DATUM_GROWTH];
+  uint16_t species = (uint16_t) (load32(growth) ^ key);
+
+  return species < SPECIES_COUNT && BITSET_TEST(legal_species, species);
+}
+
+// Whether the data at p decrypts to the checksum it's stored with
+static bool scan_checksum(const uint8_t *p) {
+  uint32_t key = load32(p + offsetof(struct Pokemon, personality)) ^
+                 load32(p + offsetof(struct Pokemon, trainer_id));
+  uint32_t sum = 0;
+
+  for(size_t i = 0; i < DATA_LENGTH; i += sizeof(uint32_t)) {
+    uint32_t word = load32(p + RECORD_DATA + i) ^ key;
+    sum += (word & 0xffff) + (word >> 16);
+  }
+  return (uint16_t) sum == load16(p + offsetof(struct Pokemon, checksum));
+}
+
+// Test offsets start to end of dump, appending hits
+// returns the number of hits
+static size_t scan_scalar(const uint8_t *dump, size_t start, size_t end, size_t *hits) {
+  size_t n = 0;
+
+  for(size_t offset = start; offset < end; offset++) {
+    if(scan_checksum(dump + offset) && scan_species(dump + offset)) hits[n++] = offset;
+  }
+  return n;
+}
+
+#ifdef HAVE_X86_SIMD
+// The eight 32 bit words starting at p, p + 1, ..., p + 7, one per lane
+__attribute__((target("avx2")))
+static inline __m256i scan_windows(const uint8_t *p) {
+  const __m256i shuffle = _mm256_setr_epi8(
+    0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6,
+    4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10);
+  __m128i bytes = _mm_loadu_si128((const __m128i *) p);
+  return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(bytes), shuffle);
+}
+
+// Eight consecutive offsets per iteration, while their last windows' 16 byte
+// loads stay within the dump
+__attribute__((target("avx2")))
+static size_t scan_avx2(const uint8_t *dump, size_t len, size_t start, size_t end,
+                        size_t *hits) {
+  const size_t reach = RECORD_DATA + DATA_LENGTH - sizeof(uint32_t) + sizeof(__m128i) + 7;
+  const __m256i low = _mm256_set1_epi32(0xffff);
+  size_t offset = start, n = 0;
+
+  for(; offset + 8 <= end && offset + reach <= len; offset += 8) {
+    const uint8_t *p = dump + offset;
+    __m256i key = _mm256_xor_si256(
+      scan_windows(p + offsetof(struct Pokemon, personality)),
+      scan_windows(p + offsetof(struct Pokemon, trainer_id)));
+    __m256i sum = _mm256_setzero_si256();
+
+    for(size_t i = 0; i < DATA_LENGTH; i += sizeof(uint32_t)) {
+      __m256i word = _mm256_xor_si256(scan_windows(p + RECORD_DATA + i), key);
+      sum = _mm256_add_epi32(sum, _mm256_add_epi32(_mm256_and_si256(word, low),
+                                                   _mm256_srli_epi32(word, 16)));
+    }
+
+    __m256i checksum = _mm256_and_si256(scan_windows(p + offsetof(struct Pokemon, checksum)), low);
+    __m256i match = _mm256_cmpeq_epi32(_mm256_and_si256(sum, low), checksum);
+    unsigned mask = (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(match));
+
+    while(mask != 0) {
+      size_t i = (size_t) __builtin_ctz(mask);
+      if(scan_species(p + i)) hits[n++] = offset + i;
+      mask &= mask - 1;
+    }
+  }
+
+  return n + scan_scalar(dump, offset, end, hits + n);
+}
+#endif
+
+static void *scan_worker(void *arg) {
+  struct Scan *scan = (struct Scan *) arg;
+  size_t last = scan->len - BOX_POKEMON_LENGTH + 1; // one past the last candidate
+  size_t *hits = malloc(SCAN_CHUNK_SIZE * sizeof(size_t));
+
+  if(hits == NULL) {
+    pthread_mutex_lock(&scan->lock);
+    scan->failed = true;
+    pthread_mutex_unlock(&scan->lock);
+    return NULL;
+  }
+
+  for(;;) {
+    size_t start = atomic_fetch_add(&scan->next_chunk, 1) * SCAN_CHUNK_SIZE;
+    if(start >= last) break;
+    size_t end = last - start < SCAN_CHUNK_SIZE ? last : start + SCAN_CHUNK_SIZE;
+
+    size_t n;
+#ifdef HAVE_X86_SIMD
+    if(__builtin_cpu_supports("avx2")) {
+      n = scan_avx2(scan->dump, scan->len, start, end, hits);
+    } else
+#endif
+    n = scan_scalar(scan->dump, start, end, hits);
+    if(n == 0) continue;
+
+    pthread_mutex_lock(&scan->lock);
+    if(scan->found + n > scan->capacity) {
+      size_t capacity = (scan->found + n) * 2;
+      size_t *all = realloc(scan->hits, capacity * sizeof(size_t));
+      if(all == NULL) {
+        scan->failed = true;
+        n = 0;
+      } else {
+        scan->hits = all;
+        scan->capacity = capacity;
+      }
+    }
+    memcpy(scan->hits + scan->found, hits, n * sizeof(size_t));
+    scan->found += n;
+    pthread_mutex_unlock(&scan->lock);
+  }
+
+  free(hits);
+  return NULL;
+}
+
+static int scan_compare(const void *a, const void *b) {
+  size_t x = *(const size_t *) a, y = *(const size_t *) b;
+  return (x > y) - (x < y);
+}
+
+// Find every offset of dump, which is len bytes long, where a pokémon record
+// starts, searching with threads threads; *hits is set to a malloc()ed array
+// of them in increasing order, and *found to how many there are
+// returns false (after complaining) if memory runs out
+bool pokegen_scan_dump(const uint8_t *dump, size_t len, unsigned threads,
+                       size_t **hits, size_t *found) {
+  struct Scan scan = {
+    .dump = dump,
+    .len = len,
+    .hits = NULL,
+    .found = 0,
+    .capacity = 0,
+    .failed = false
+  };
+
+  *hits = NULL;
+  *found = 0;
+  if(len < BOX_POKEMON_LENGTH) return true;
+
+  atomic_init(&scan.next_chunk, 0);
+  pthread_mutex_init(&scan.lock, NULL);
+  pthread_t *pool = calloc(threads, sizeof(pthread_t));
+
+  unsigned started = 0;
+  for(; pool != NULL && started < threads; started++) {
+    if(pthread_create(&pool[started], NULL, scan_worker, &scan) != 0) break;
+  }
+  if(started == 0) scan_worker(&scan);
+  for(unsigned i = 0; i < started; i++) {
+    pthread_join(pool[i], NULL);
+  }
+
+  pthread_mutex_destroy(&scan.lock);
+  free(pool);
+  if(scan.failed) {
+    // a worker's error is its own thread's, so it's reported from this one
+    complain("scan: %s", strerror(ENOMEM));
+    free(scan.hits);
+    return false;
+  }
+
+  qsort(scan.hits, scan.found, sizeof(size_t), scan_compare);
+  *hits = scan.hits;
+  *found = scan.found;
+  return true;
+}
+
+/* Corpus archives */
+const struct ArchiveColumn archive_columns[ARCHIVE_COLUMNS] = {
+  {"personality", 0, 4},
+  {"trainer-id", 4, 4},
+  {"nickname-bytes", 8, 8},
+  {"nickname-bytes-end", 16, 2},
+  {"met-language", 18, 2},
+  {"trainer-name-bytes", 20, 7},
+  {"markings", 27, 1},
+  {"checksum", 28, 2},
+  {"unknown", 30, 2},
+  // data, from growth to misc
+  {"species", 32, 2},
+  {"item", 34, 2},
+  {"experience", 36, 4},
+  {"pp-bonus", 40, 1},
+  {"friendship", 41, 1},
+  {"growth-unknown", 42, 2},
+  {"move1", 44, 2},
+  {"move2", 46, 2},
+  {"move3", 48, 2},
+  {"move4", 50, 2},
+  {"moves-pp", 52, 4},
+  {"evs", 56, 6},
+  {"contest", 62, 6},
+  {"pokerus", 68, 1},
+  {"met-location", 69, 1},
+  {"origins", 70, 2},
+  {"ivs", 72, 4},
+  {"ribbons", 76, 4},
+  // party fields
+  {"status", 80, 4},
+  {"level", 84, 1},
+  {"pokerus-left", 85, 1},
+  {"hp", 86, 2},
+  {"max-hp", 88, 2},
+  {"attack", 90, 2},
+  {"defense", 92, 2},
+  {"speed", 94, 2},
+  {"special-attack", 96, 2},
+  {"special-defense", 98, 2}
+};
+
+// Little-endian value of size bytes
+static uint64_t column_load(const uint8_t *p, size_t size) {
+  uint64_t v = 0;
+  for(size_t i = size; i-- > 0;) v = (v << 8) | p[i];
+  return v;
+}
+
+static void column_store(uint8_t *p, size_t size, uint64_t v) {
+  for(size_t i = 0; i < size; i++, v >>= 8) p[i] = (uint8_t) v;
+}
+
+// Or bits bits of v into packed at bit pos, which must be zeroed
+static void bits_store(uint8_t *packed, uint64_t pos, unsigned bits, uint64_t v) {
+  uint8_t *p = packed + (pos / 8);
+  unsigned shift = (unsigned) (pos % 8);
+
+  store64(p, load64(p) | (v << shift));
+  if(shift + bits > 64) p[8] |= (uint8_t) (v >> (64 - shift));
+}
+
+static uint64_t bits_load(const uint8_t *packed, uint64_t pos, unsigned bits) {
+  if(bits == 0) return 0;
+
+  const uint8_t *p = packed + (pos / 8);
+  unsigned shift = (unsigned) (pos % 8);
+  uint64_t v = load64(p) >> shift;
+
+  if(shift + bits > 64) v |= (uint64_t) p[8] << (64 - shift);
+  return bits == 64 ? v : v & ((1ULL << bits) - 1);
+}
+
+// Lay out an encoded record plainly, with its data decrypted and in order
+static void archive_plain(uint8_t *plain, const uint8_t *record) {
+  uint32_t personality = load32(record + offsetof(struct Pokemon, personality));
+  uint32_t key = personality ^ load32(record + offsetof(struct Pokemon, trainer_id));
+  const uint8_t *offset = datum_offset[personality % DATUM_ORDERS];
+
+  memcpy(plain, record, sizeof(struct Pokemon));
+  for(size_t i = 0; i < DATUM_PER_DATA; i++) {
+    memcpy(plain + RECORD_DATA + (i * DATUM_LENGTH), record + RECORD_DATA + offset[i],
+           DATUM_LENGTH);
+  }
+  data_crypt(plain + RECORD_DATA, DATA_LENGTH, key);
+}
+
+// Encode a plain record back into the record it was laid out from
+static void archive_encode(uint8_t *record, const uint8_t *plain) {
+  uint32_t personality = load32(plain + offsetof(struct Pokemon, personality));
+  uint32_t key = personality ^ load32(plain + offsetof(struct Pokemon, trainer_id));
+  const uint8_t *offset = datum_offset[personality % DATUM_ORDERS];
+
+  memcpy(record, plain, sizeof(struct Pokemon));
+  for(size_t i = 0; i < DATUM_PER_DATA; i++) {
+    memcpy(record + RECORD_DATA + offset[i], plain + RECORD_DATA + (i * DATUM_LENGTH),
+           DATUM_LENGTH);
+  }
+  data_crypt(record + RECORD_DATA, DATA_LENGTH, key);
+}
+
+// Start writing an archive to path
+// returns false (after complaining) if it can't be created
+bool pokegen_archive_create(struct ArchiveWriter *w, const char *path) {
+  static const uint8_t header[ARCHIVE_HEADER_SIZE] = {0};
+
+  *w = (struct ArchiveWriter) {
+    .path = path,
+    .n = 0,
+    .records = 0,
+    .offset = ARCHIVE_HEADER_SIZE,
+    .index = NULL,
+    .index_len = 0,
+    .index_cap = 0
+  };
+  // the block's plain records, then room to pack one column of it
+  w->plain = malloc((ARCHIVE_BLOCK * sizeof(struct Pokemon)) +
+                    (ARCHIVE_BLOCK * sizeof(uint64_t)) + ARCHIVE_PADDING);
+  if(w->plain == NULL) {
+    complain("%s: %s", path, strerror(errno));
+    return false;
+  }
+
+  // the header is written over once the records are counted
+  if((w->file = fopen(path, "wb")) == NULL ||
+     fwrite(header, 1, sizeof(header), w->file) != sizeof(header)) {
+    complain("%s: %s", path, strerror(errno));
+    if(w->file != NULL) fclose(w->file);
+    free(w->plain);
+    return false;
+  }
+  return true;
+}
+
+// Pack each column of the gathered block, and write it out
+// returns false (after complaining) if it can't be written
+static bool archive_flush(struct ArchiveWriter *w) {
+  uint8_t *packed = w->plain + (ARCHIVE_BLOCK * sizeof(struct Pokemon));
+
+  if(w->index_len + (ARCHIVE_COLUMNS * ARCHIVE_ENTRY_SIZE) > w->index_cap) {
+    size_t cap = w->index_cap == 0 ? 64 * ARCHIVE_COLUMNS * ARCHIVE_ENTRY_SIZE : w->index_cap * 2;
+    uint8_t *index = realloc(w->index, cap);
+    if(index == NULL) {
+      complain("%s: %s", w->path, strerror(errno));
+      return false;
+    }
+    w->index = index;
+    w->index_cap = cap;
+  }
+
+  for(size_t c = 0; c < ARCHIVE_COLUMNS; c++) {
+    const struct ArchiveColumn *col = &archive_columns[c];
+    const uint8_t *field = w->plain + col->offset;
+    uint64_t least = UINT64_MAX, most = 0;
+
+    for(size_t i = 0; i < w->n; i++) {
+      uint64_t v = column_load(field + (i * sizeof(struct Pokemon)), col->size);
+      least = v < least ? v : least;
+      most = v > most ? v : most;
+    }
+
+    unsigned bits = most == least ? 0 : 64 - (unsigned) __builtin_clzll(most - least);
+    size_t len = ((w->n * bits) + 7) / 8;
+    memset(packed, 0, len + ARCHIVE_PADDING);
+    for(size_t i = 0; i < w->n && bits > 0; i++) {
+      uint64_t v = column_load(field + (i * sizeof(struct Pokemon)), col->size);
+      bits_store(packed, i * bits, bits, v - least);
+    }
+    if(fwrite(packed, 1, len + ARCHIVE_PADDING, w->file) != len + ARCHIVE_PADDING) {
+      complain("%s: %s", w->path, strerror(errno));
+      return false;
+    }
+
+    uint8_t *entry = w->index + w->index_len;
+    memset(entry, 0, ARCHIVE_ENTRY_SIZE);
+    store64(entry, w->offset);
+    store64(entry + 8, least);
+    entry[16] = (uint8_t) bits;
+    w->index_len += ARCHIVE_ENTRY_SIZE;
+    w->offset += len + ARCHIVE_PADDING;
+  }
+
+  w->n = 0;
+  return true;
+}
+
+// Add n encoded pokémon to an archive
+// returns false (after complaining) if they can't be written
+bool pokegen_archive_append(struct ArchiveWriter *w, const struct Pokemon *pkmn, size_t n) {
+  for(size_t i = 0; i < n; i++) {
+    archive_plain(w->plain + (w->n * sizeof(struct Pokemon)), (const uint8_t *) &pkmn[i]);
+    w->records++;
+    if(++w->n == ARCHIVE_BLOCK && !archive_flush(w)) return false;
+  }
+  return true;
+}
+
+// Write out the last block, the index and the header, and close the archive
+// returns false (after complaining) if they can't be written
+bool pokegen_archive_finish(struct ArchiveWriter *w) {
+  uint8_t header[ARCHIVE_HEADER_SIZE] = {0};
+  bool ok = w->n == 0 || archive_flush(w);
+
+  store32(header, ARCHIVE_MAGIC);
+  store32(header + 4, ARCHIVE_VERSION);
+  store64(header + 8, w->records);
+  store32(header + 16, ARCHIVE_BLOCK);
+  store32(header + 20, ARCHIVE_COLUMNS);
+  store32(header + 24, sizeof(struct Pokemon));
+  store64(header + 32, w->offset);
+
+  if(ok && (fwrite(w->index, 1, w->index_len, w->file) != w->index_len ||
+            fseek(w->file, 0, SEEK_SET) != 0 ||
+            fwrite(header, 1, sizeof(header), w->file) != sizeof(header))) {
+    complain("%s: %s", w->path, strerror(errno));
+    ok = false;
+  }
+  if(fclose(w->file) != 0 && ok) {
+    complain("%s: %s", w->path, strerror(errno));
+    ok = false;
+  }
+  free(w->plain);
+  free(w->index);
+  return ok;
+}
+
+// Map an archive, and check that its index only points within it
+// returns false (after complaining) if path isn't a valid archive
+bool pokegen_archive_open(struct Archive *a, const char *path) {
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+
+  if(fd < 0 || fstat(fd, &st) < 0) {
+    complain("%s: %s", path, strerror(errno));
+    if(fd >= 0) close(fd);
+    return false;
+  } else if(st.st_size < ARCHIVE_HEADER_SIZE) {
+    complain("%s: too small to be an archive", path);
+    close(fd);
+    return false;
+  }
+
+  a->size = (size_t) st.st_size;
+  a->map = mmap(NULL, a->size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(a->map == MAP_FAILED) {
+    complain("%s: %s", path, strerror(errno));
+    return false;
+  }
+
+  if(load32(a->map) != ARCHIVE_MAGIC || load32(a->map + 4) != ARCHIVE_VERSION ||
+     load32(a->map + 16) != ARCHIVE_BLOCK || load32(a->map + 20) != ARCHIVE_COLUMNS ||
+     load32(a->map + 24) != sizeof(struct Pokemon)) {
+    complain("%s: not an archive this version can read", path);
+    pokegen_archive_close(a);
+    return false;
+  }
+
+  a->records = load64(a->map + 8);
+  uint64_t index = load64(a->map + 32);
+  uint64_t blocks = (a->records + ARCHIVE_BLOCK - 1) / ARCHIVE_BLOCK;
+  bool valid = index <= a->size && blocks <= (a->size - index) / (ARCHIVE_COLUMNS * ARCHIVE_ENTRY_SIZE);
+
+  a->index = a->map + index;
+  for(uint64_t b = 0; valid && b < blocks; b++) {
+    uint64_t rows = b + 1 < blocks ? ARCHIVE_BLOCK : a->records - (b * ARCHIVE_BLOCK);
+    for(size_t c = 0; valid && c < ARCHIVE_COLUMNS; c++) {
+      const uint8_t *entry = a->index + (((b * ARCHIVE_COLUMNS) + c) * ARCHIVE_ENTRY_SIZE);
+      uint64_t offset = load64(entry);
+      unsigned bits = entry[16];
+      valid = bits <= archive_columns[c].size * 8 && offset <= index &&
+              ((rows * bits) + 7) / 8 + ARCHIVE_PADDING <= index - offset;
+    }
+  }
+  if(!valid) {
+    complain("%s: archive is truncated or damaged", path);
+    pokegen_archive_close(a);
+    return false;
+  }
+  return true;
+}
+
+// Value of column of record, which must be in the archive
+uint64_t pokegen_archive_value(const struct Archive *a, uint64_t record, size_t column) {
+  const uint8_t *entry = a->index +
+    ((((record / ARCHIVE_BLOCK) * ARCHIVE_COLUMNS) + column) * ARCHIVE_ENTRY_SIZE);
+  unsigned bits = entry[16];
+
+  return load64(entry + 8) + bits_load(a->map + load64(entry), (record % ARCHIVE_BLOCK) * bits, bits);
+}
+
+// Lay out n records, from record first, which must be in the archive, as plain
+// records; only the columns with their bit set in columns are filled in
+void pokegen_archive_gather(const struct Archive *a, uint64_t first, size_t n, uint64_t columns,
+                            uint8_t *plain) {
+  for(size_t done = 0; done < n;) {
+    uint64_t record = first + done;
+    uint64_t block = record / ARCHIVE_BLOCK;
+    size_t row = (size_t) (record % ARCHIVE_BLOCK);
+    size_t rows = ARCHIVE_BLOCK - row < n - done ? ARCHIVE_BLOCK - row : n - done;
+
+    // a column of a block at a time, so its entry is only read once
+    for(size_t c = 0; c < ARCHIVE_COLUMNS; c++) {
+      if(!(columns & (1ULL << c))) continue;
+
+      const struct ArchiveColumn *col = &archive_columns[c];
+      const uint8_t *entry = a->index + (((block * ARCHIVE_COLUMNS) + c) * ARCHIVE_ENTRY_SIZE);
+      const uint8_t *packed = a->map + load64(entry);
+      uint64_t least = load64(entry + 8);
+      unsigned bits = entry[16];
+      uint8_t *field = plain + (done * sizeof(struct Pokemon)) + col->offset;
+
+      for(size_t i = 0; i < rows; i++) {
+        column_store(field + (i * sizeof(struct Pokemon)), col->size,
+                     least + bits_load(packed, (row + i) * bits, bits));
+      }
+    }
+    done += rows;
+  }
+}
+
+// Rebuild n encoded pokémon, from record first, which must be in the archive
+void pokegen_archive_records(const struct Archive *a, uint64_t first, size_t n,
+                             struct Pokemon *dest) {
+  uint8_t plain[sizeof(struct Pokemon)];
+
+  // gather into dest, then encode each in place
+  pokegen_archive_gather(a, first, n, ARCHIVE_ALL_COLUMNS, (uint8_t *) dest);
+  for(size_t i = 0; i < n; i++) {
+    memcpy(plain, &dest[i], sizeof(plain));
+    archive_encode((uint8_t *) &dest[i], plain);
+  }
+}
+
+void pokegen_archive_close(struct Archive *a) {
+  munmap((void *) a->map, a->size);
+}
+
+/* Record queries
+ * Each term reads one field of a block of plain records into an array of
+ * values, then tests the whole array against its range, so the tests run
+ * branch free over a column at a time rather than a record at a time. */
+#define QUERY_FIELD 0 // bits of a little-endian field of the plain record
+#define QUERY_MOVE 1 // any of the four moves
+#define QUERY_LEVEL 2 // from the experience, if the record has no party fields
+#define QUERY_NATURE 3
+#define QUERY_SHINY 4
+
+// A field that can be queried; names follow the keys of --decode
+struct QueryField {
+  const char *name;
+  uint8_t kind;
+  uint8_t offset; // bytes of the plain record it reads
+  uint8_t size;
+  uint8_t shift;
+  uint8_t bits;
+  const struct NameTable *table; // values may be named from table
+  const char *const *names; // or from names, in order
+  uint8_t count;
+};
+
+static const char *const gender_names[2] = {"male", "female"};
+static const char *const ability_names[2] = {"primary", "secondary"};
+
+static const struct QueryField query_fields[] = {
+  {"personality", QUERY_FIELD, 0, 4, 0, 32, NULL, NULL, 0},
+  {"trainer-id", QUERY_FIELD, 4, 4, 0, 32, NULL, NULL, 0},
+  {"met-language", QUERY_FIELD, 18, 2, 0, 16, &languages_table, NULL, 0},
+  {"markings", QUERY_FIELD, 27, 1, 0, 8, NULL, NULL, 0},
+  {"species", QUERY_FIELD, 32, 2, 0, 16, &species_table, NULL, 0},
+  {"item", QUERY_FIELD, 34, 2, 0, 16, &items_table, NULL, 0},
+  {"experience", QUERY_FIELD, 36, 4, 0, 32, NULL, NULL, 0},
+  {"friendship", QUERY_FIELD, 41, 1, 0, 8, NULL, NULL, 0},
+  {"move", QUERY_MOVE, 44, 8, 0, 16, &moves_table, NULL, 0},
+  {"ev-hp", QUERY_FIELD, 56, 1, 0, 8, NULL, NULL, 0},
+  {"ev-attack", QUERY_FIELD, 57, 1, 0, 8, NULL, NULL, 0},
+  {"ev-defense", QUERY_FIELD, 58, 1, 0, 8, NULL, NULL, 0},
+  {"ev-speed", QUERY_FIELD, 59, 1, 0, 8, NULL, NULL, 0},
+  {"ev-special-attack", QUERY_FIELD, 60, 1, 0, 8, NULL, NULL, 0},
+  {"ev-special-defense", QUERY_FIELD, 61, 1, 0, 8, NULL, NULL, 0},
+  {"coolness", QUERY_FIELD, 62, 1, 0, 8, NULL, NULL, 0},
+  {"beauty", QUERY_FIELD, 63, 1, 0, 8, NULL, NULL, 0},
+  {"cuteness", QUERY_FIELD, 64, 1, 0, 8, NULL, NULL, 0},
+  {"smartness", QUERY_FIELD, 65, 1, 0, 8, NULL, NULL, 0},
+  {"toughness", QUERY_FIELD, 66, 1, 0, 8, NULL, NULL, 0},
+  {"feel", QUERY_FIELD, 67, 1, 0, 8, NULL, NULL, 0},
+  {"pokerus", QUERY_FIELD, 68, 1, 0, 8, NULL, NULL, 0},
+  {"met-location", QUERY_FIELD, 69, 1, 0, 8, &locations_table, NULL, 0},
+  {"met-level", QUERY_FIELD, 70, 2, 0, LEVEL_MET_BITS, NULL, NULL, 0},
+  {"met-game", QUERY_FIELD, 70, 2, 7, GAME_MET_BITS, &games_table, NULL, 0},
+  {"pokeball", QUERY_FIELD, 70, 2, 11, POKEBALL_TYPE_BITS, &balls_table, NULL, 0},
+  {"trainer-gender", QUERY_FIELD, 70, 2, 15, 1, NULL, gender_names, 2},
+  {"iv-hp", QUERY_FIELD, 72, 4, 0, IV_BITS, NULL, NULL, 0},
+  {"iv-attack", QUERY_FIELD, 72, 4, 5, IV_BITS, NULL, NULL, 0},
+  {"iv-defense", QUERY_FIELD, 72, 4, 10, IV_BITS, NULL, NULL, 0},
+  {"iv-speed", QUERY_FIELD, 72, 4, 15, IV_BITS, NULL, NULL, 0},
+  {"iv-special-attack", QUERY_FIELD, 72, 4, 20, IV_BITS, NULL, NULL, 0},
+  {"iv-special-defense", QUERY_FIELD, 72, 4, 25, IV_BITS, NULL, NULL, 0},
+  {"egg", QUERY_FIELD, 72, 4, 30, 1, NULL, NULL, 0},
+  {"ability", QUERY_FIELD, 72, 4, 31, 1, NULL, ability_names, 2},
+  {"ribbons", QUERY_FIELD, 76, 4, 0, 32, NULL, NULL, 0},
+  {"status", QUERY_FIELD, 80, 4, 0, 32, NULL, NULL, 0},
+  {"level", QUERY_LEVEL, 84, 1, 0, 8, NULL, NULL, 0},
+  {"pokerus-left", QUERY_FIELD, 85, 1, 0, 8, NULL, NULL, 0},
+  {"hp", QUERY_FIELD, 86, 2, 0, 16, NULL, NULL, 0},
+  {"max-hp", QUERY_FIELD, 88, 2, 0, 16, NULL, NULL, 0},
+  {"attack", QUERY_FIELD, 90, 2, 0, 16, NULL, NULL, 0},
+  {"defense", QUERY_FIELD, 92, 2, 0, 16, NULL, NULL, 0},
+  {"speed", QUERY_FIELD, 94, 2, 0, 16, NULL, NULL, 0},
+  {"special-attack", QUERY_FIELD, 96, 2, 0, 16, NULL, NULL, 0},
+  {"special-defense", QUERY_FIELD, 98, 2, 0, 16, NULL, NULL, 0},
+  {"nature", QUERY_NATURE, 0, 4, 0, 8, NULL, nature_names, NATURES},
+  {"shiny", QUERY_SHINY, 0, 8, 0, 1, NULL, NULL, 0}
+};
+
+#define QUERY_FIELDS (sizeof(query_fields) / sizeof(query_fields[0]))
+
+// Lay out n encoded records plainly, with their data decrypted and in order
+void pokegen_plain(uint8_t *plain, const struct Pokemon *src, size_t n) {
+  for(size_t i = 0; i < n; i++) {
+    archive_plain(plain + (i * sizeof(struct Pokemon)), (const uint8_t *) &src[i]);
+  }
+}
+
+// Bit per archive column holding any of the size bytes from offset
+static uint64_t archive_column_mask(size_t offset, size_t size) {
+  uint64_t mask = 0;
+
+  for(size_t c = 0; c < ARCHIVE_COLUMNS; c++) {
+    const struct ArchiveColumn *col = &archive_columns[c];
+    if(col->offset < offset + size && offset < (size_t) col->offset + col->size) {
+      mask |= 1ULL << c;
+    }
+  }
+  return mask;
+}
+
+// Parse arg as a number, or one of the names of field's values
+// returns false (after complaining) if it's neither
+static bool query_value(const struct QueryField *field, const char *arg, uint32_t *value) {
+  if(*arg >= '0' && *arg <= '9') {
+    char *end;
+    unsigned long long v = strtoull(arg, &end, 0);
+    if(*end == '\0' && v <= UINT32_MAX) {
+      *value = (uint32_t) v;
+      return true;
+    }
+  } else if(field->table != NULL) {
+    uint16_t v;
+    if(name_lookup(field->table, arg, &v)) {
+      *value = v;
+      return true;
+    }
+  } else {
+    for(uint8_t i = 0; i < field->count; i++) {
+      if(!strcasecmp(arg, field->names[i])) {
+        *value = i;
+        return true;
+      }
+    }
+  }
+
+  complain("'%s' isn't a %s", arg, field->name);
+  return false;
+}
+
+// Parse a comma separated list of terms into q
+// returns false (after complaining) if any is invalid
+bool pokegen_query_parse(struct Query *q, char *arg) {
+  char *save = NULL;
+
+  q->terms = 0;
+  q->columns = 0;
+  for(char *c = strtok_r(arg, ",", &save); c != NULL; c = strtok_r(NULL, ",", &save)) {
+    size_t len = strcspn(c, "=!<>");
+    char *op = c + len;
+    const struct QueryField *field = NULL;
+    uint8_t number = 0;
+
+    for(size_t i = 0; i < QUERY_FIELDS; i++) {
+      if(strlen(query_fields[i].name) == len && !strncasecmp(c, query_fields[i].name, len)) {
+        field = &query_fields[i];
+        number = (uint8_t) i;
+      }
+    }
+    if(field == NULL) {
+      complain("unknown query field '%.*s'", (int) len, c);
+      return false;
+    } else if(q->terms == QUERY_TERMS) {
+      complain("a query can have at most %d terms", QUERY_TERMS);
+      return false;
+    }
+
+    struct QueryTerm *t = &q->term[q->terms];
+    // turn the comparison into a range of values, and whether to be outside it;
+    // a move term is in the range if any of the four slots is, so not equal is
+    // outside the equal range, meaning none of them is the move
+    size_t op_len = strspn(op, "=!<>");
+    char cmp[3] = "";
+    uint32_t v = 0;
+    if(op_len < sizeof(cmp)) memcpy(cmp, op, op_len);
+
+    if(op_len == 0) {
+      // just the field; it isn't 0
+      *t = (struct QueryTerm) {number, false, 1, UINT32_MAX - 1};
+    } else if(!query_value(field, op + op_len, &v)) {
+      return false;
+    } else if(!strcmp(cmp, "=")) {
+      *t = (struct QueryTerm) {number, false, v, 0};
+    } else if(!strcmp(cmp, "!=")) {
+      *t = (struct QueryTerm) {number, true, v, 0};
+    } else if(!strcmp(cmp, "<=")) {
+      *t = (struct QueryTerm) {number, false, 0, v};
+    } else if(!strcmp(cmp, ">=")) {
+      *t = (struct QueryTerm) {number, false, v, UINT32_MAX - v};
+    } else if(!strcmp(cmp, "<")) {
+      // < 0 is an empty range, so outside the range of everything
+      *t = v == 0 ? (struct QueryTerm) {number, true, 0, UINT32_MAX} :
+                    (struct QueryTerm) {number, false, 0, v - 1};
+    } else if(!strcmp(cmp, ">")) {
+      *t = v == UINT32_MAX ? (struct QueryTerm) {number, true, 0, UINT32_MAX} :
+                             (struct QueryTerm) {number, false, v + 1, UINT32_MAX - v - 1};
+    } else {
+      complain("'%.*s' isn't one of = != < <= > >=", (int) op_len, op);
+      return false;
+    }
+
+    q->columns |= archive_column_mask(field->offset, field->size);
+    if(field->kind == QUERY_LEVEL) {
+      q->columns |= archive_column_mask(offsetof(struct Pokemon, data), sizeof(uint16_t)) |
+                    archive_column_mask(offsetof(struct Pokemon, data) + 4, sizeof(uint32_t));
+    }
+    q->terms++;
+  }
+
+  return true;
+}
+
+// Set values[i] to field of the i-th of n plain records, reading move slot
+// for QUERY_MOVE
+static void query_extract(const struct QueryField *field, unsigned slot,
+                          const uint8_t *plain, size_t n, uint32_t *values) {
+  const uint8_t *p = plain + field->offset;
+  const uint32_t mask = field->bits == 32 ? UINT32_MAX : (1U << field->bits) - 1;
+  const unsigned shift = field->shift;
+
+  switch(field->kind) {
+  case QUERY_FIELD:
+    for(size_t i = 0; i < n; i++, p += sizeof(struct Pokemon)) {
+      uint32_t v = field->size == 1 ? *p : field->size == 2 ? load16(p) : load32(p);
+      values[i] = (v >> shift) & mask;
+    }
+    break;
+  case QUERY_MOVE:
+    p += slot * sizeof(uint16_t);
+    for(size_t i = 0; i < n; i++, p += sizeof(struct Pokemon)) values[i] = load16(p);
+    break;
+  case QUERY_LEVEL:
+    for(size_t i = 0; i < n; i++, p += sizeof(struct Pokemon)) {
+      const uint8_t *growth = p - field->offset + RECORD_DATA;
+      uint16_t species = load16(growth);
+
+      // box pokémon have no level, but it follows from their experience
+      values[i] = *p != 0 ? *p : pokegen_level(
+        species_info[species < SPECIES_COUNT ? species : 0].growth_rate, load32(growth + 4));
+    }
+    break;
+  case QUERY_NATURE:
+    for(size_t i = 0; i < n; i++, p += sizeof(struct Pokemon)) values[i] = load32(p) % NATURES;
+    break;
+  case QUERY_SHINY:
+    for(size_t i = 0; i < n; i++, p += sizeof(struct Pokemon)) {
+      uint32_t pid = load32(p), tid = load32(p + 4);
+      values[i] = ((pid >> 16) ^ (pid & 0xffff) ^ (tid >> 16) ^ (tid & 0xffff)) < 8;
+    }
+    break;
+  }
+}
+
+// Set hit[i] if values[i] is in the term's range
+// Branch free, so it vectorises
+#ifdef HAVE_X86_SIMD
+__attribute__((target_clones("avx2", "default")))
+#endif
+static void query_range(const struct QueryTerm *t, const uint32_t *values, size_t n, uint8_t *hit) {
+  const uint32_t least = t->least, span = t->span;
+
+  for(size_t i = 0; i < n; i++) {
+    hit[i] |= (uint8_t) ((values[i] - least) <= span);
+  }
+}
+
+// Set match[i] to whether the i-th of n plain records matches every term of q
+// returns the number that match
+size_t pokegen_query_match(const struct Query *q, const uint8_t *plain, size_t n, uint8_t *match) {
+  uint32_t values[QUERY_BLOCK];
+  uint8_t hit[QUERY_BLOCK];
+  size_t found = 0;
+
+  for(size_t start = 0; start < n; start += QUERY_BLOCK) {
+    const uint8_t *block = plain + (start * sizeof(struct Pokemon));
+    uint8_t *m = match + start;
+    size_t len = n - start < QUERY_BLOCK ? n - start : QUERY_BLOCK;
+    uint8_t any = 1;
+
+    memset(m, 1, len);
+    for(size_t i = 0; i < q->terms && any; i++) {
+      const struct QueryTerm *t = &q->term[i];
+      const struct QueryField *field = &query_fields[t->field];
+      const uint8_t invert = t->invert;
+
+      memset(hit, 0, len);
+      for(unsigned slot = 0; slot < (field->kind == QUERY_MOVE ? 4U : 1U); slot++) {
+        query_extract(field, slot, block, len, values);
+        query_range(t, values, len, hit);
+      }
+
+      // once no record of the block is left, the rest of the terms can't matter
+      any = 0;
+      for(size_t j = 0; j < len; j++) {
+        m[j] &= hit[j] ^ invert;
+        any |= m[j];
+      }
+    }
+
+    for(size_t j = 0; j < len && any; j++) found += m[j];
+  }
+
+  return found;
+}
+
+/* Shared memory ring */
+#define RING_SPINS 1024
+
+// Wait a little longer for the other side of the ring each time
+static void ring_backoff(unsigned spins) {
+  if(spins < RING_SPINS) {
+#ifdef HAVE_X86_SIMD
+    _mm_pause();
+#endif
+  } else {
+    sched_yield();
+  }
+}
+
+// Name a ring's shared memory object as shm_open wants it, with a leading slash
+// returns false (after complaining) if it can't be one
+static bool ring_name(char *path, size_t size, const char *name) {
+  int n = snprintf(path, size, "%s%s", name[0] == '/' ? "" : "/", name);
+
+  if(n < 2 || (size_t) n >= size || strchr(path + 1, '/') != NULL) {
+    complain("%s: not a shared memory name", name);
+    return false;
+  }
+  return true;
+}
+
+// Create a ring of slots (a power of two) in shared memory, replacing any old
+// one of the same name, whose consumers keep their own copy
+// returns false (after complaining) if it can't be
+bool pokegen_ring_create(struct Ring *ring, const char *name, uint32_t slots, uint32_t policy) {
+  char path[256];
+
+  if(slots == 0 || (slots & (slots - 1)) != 0 || slots > RING_SLOTS_MAX) {
+    complain("ring slots must be a power of two up to 16777216");
+    return false;
+  }
+  if(!ring_name(path, sizeof(path), name)) return false;
+
+  shm_unlink(path);
+  int fd = shm_open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+  if(fd < 0) {
+    complain("%s: %s", path, strerror(errno));
+    return false;
+  }
+
+  ring->size = sizeof(struct RingHeader) + ((size_t) slots * sizeof(struct RingSlot));
+  if(ftruncate(fd, (off_t) ring->size) != 0) {
+    complain("%s: %s", path, strerror(errno));
+    close(fd);
+    shm_unlink(path);
+    return false;
+  }
+
+  ring->header = mmap(NULL, ring->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(ring->header == MAP_FAILED) {
+    complain("%s: %s", path, strerror(errno));
+    shm_unlink(path);
+    return false;
+  }
+
+  struct RingHeader *h = ring->header;
+  h->version = RING_VERSION;
+  h->record_size = sizeof(struct Pokemon);
+  h->slot_size = sizeof(struct RingSlot);
+  h->slots = slots;
+  h->policy = policy;
+  atomic_init(&h->closed, false);
+  atomic_init(&h->dropped, 0);
+  atomic_init(&h->head, 0);
+  atomic_init(&h->tail, 0);
+  for(uint32_t i = 0; i < slots; i++) atomic_init(&h->slot[i].seq, i);
+  atomic_store_explicit(&h->magic, RING_MAGIC, memory_order_release);
+  return true;
+}
+
+// Publish n records, in order, as the ring's only producer
+// returns how many were published; the rest were dropped by policy
+size_t pokegen_ring_publish(struct Ring *ring, const struct Pokemon *pkmn, size_t n) {
+  struct RingHeader *h = ring->header;
+  uint64_t mask = h->slots - 1;
+  uint64_t head = atomic_load_explicit(&h->head, memory_order_relaxed);
+  size_t published = 0;
+
+  for(size_t i = 0; i < n; i++) {
+    struct RingSlot *slot = &h->slot[head & mask];
+    bool full = false;
+
+    // a slot is free once its seq comes round to the head
+    for(unsigned spins = 0; atomic_load_explicit(&slot->seq, memory_order_acquire) != head; spins++) {
+      if(h->policy == RING_DROP) {
+        full = true;
+        break;
+      }
+      ring_backoff(spins);
+    }
+    if(full) {
+      atomic_fetch_add_explicit(&h->dropped, 1, memory_order_relaxed);
+      continue;
+    }
+
+    memcpy(&slot->pkmn, &pkmn[i], sizeof(slot->pkmn));
+    atomic_store_explicit(&slot->seq, head + 1, memory_order_release);
+    head++;
+    published++;
+  }
+
+  atomic_store_explicit(&h->head, head, memory_order_release);
+  return published;
+}
+
+// Mark a ring as finished, for its consumers to drain, and unmap it
+void pokegen_ring_finish(struct Ring *ring) {
+  atomic_store_explicit(&ring->header->closed, true, memory_order_release);
+  pokegen_ring_close(ring);
+}
+
+// Map an existing ring to consume from
+// returns false (after complaining) if it isn't a (finished initialising) ring
+bool pokegen_ring_open(struct Ring *ring, const char *name) {
+  char path[256];
+  struct stat st;
+
+  if(!ring_name(path, sizeof(path), name)) return false;
+
+  int fd = shm_open(path, O_RDWR, 0);
+  if(fd < 0) {
+    complain("%s: %s", path, strerror(errno));
+    return false;
+  }
+  if(fstat(fd, &st) != 0) {
+    complain("%s: %s", path, strerror(errno));
+    close(fd);
+    return false;
+  }
+
+  ring->size = (size_t) st.st_size;
+  ring->header = ring->size < sizeof(struct RingHeader) ? MAP_FAILED :
+    mmap(NULL, ring->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(ring->header == MAP_FAILED) {
+    complain("%s: not a pokégen ring", path);
+    return false;
+  }
+
+  struct RingHeader *h = ring->header;
+  if(atomic_load_explicit(&h->magic, memory_order_acquire) != RING_MAGIC ||
+     h->version != RING_VERSION || h->record_size != sizeof(struct Pokemon) ||
+     h->slot_size != sizeof(struct RingSlot) ||
+     ring->size < sizeof(struct RingHeader) + ((size_t) h->slots * sizeof(struct RingSlot))) {
+    complain("%s: not a pokégen ring, or not one of this version", path);
+    pokegen_ring_close(ring);
+    return false;
+  }
+  return true;
+}
+
+// Claim the next record, waiting for one to be published, and set seq to
+// hand back to pokegen_ring_release once done with it; the record stays in place
+// returns NULL once the producer has finished and every record is claimed
+const struct Pokemon *pokegen_ring_claim(struct Ring *ring, uint64_t *seq) {
+  struct RingHeader *h = ring->header;
+  uint64_t mask = h->slots - 1;
+  uint64_t pos = atomic_load_explicit(&h->tail, memory_order_relaxed);
+
+  for(unsigned spins = 0;;) {
+    struct RingSlot *slot = &h->slot[pos & mask];
+    uint64_t ready = atomic_load_explicit(&slot->seq, memory_order_acquire);
+    int64_t diff = (int64_t) (ready - (pos + 1));
+
+    if(diff == 0) {
+      if(atomic_compare_exchange_weak_explicit(&h->tail, &pos, pos + 1,
+                                               memory_order_relaxed, memory_order_relaxed)) {
+        *seq = pos;
+        return &slot->pkmn;
+      }
+      // pos is now the tail another consumer moved it to
+    } else if(diff < 0) {
+      // not published yet; closed is only set after everything is
+      if(atomic_load_explicit(&h->closed, memory_order_acquire) &&
+         atomic_load_explicit(&slot->seq, memory_order_acquire) == ready) {
+        return NULL;
+      }
+      ring_backoff(spins++);
+      pos = atomic_load_explicit(&h->tail, memory_order_relaxed);
+    } else {
+      // already claimed by another consumer
+      pos = atomic_load_explicit(&h->tail, memory_order_relaxed);
+    }
+  }
+}
+
+// Free the slot of a claimed record for the producer to reuse
+void pokegen_ring_release(struct Ring *ring, uint64_t seq) {
+  struct RingHeader *h = ring->header;
+  struct RingSlot *slot = &h->slot[seq & (h->slots - 1)];
+
+  atomic_store_explicit(&slot->seq, seq + h->slots, memory_order_release);
+}
+
+// Copy the next record to dest, waiting for one to be published
+// returns false once the producer has finished and every record is consumed
+bool pokegen_ring_consume(struct Ring *ring, struct Pokemon *dest) {
+  uint64_t seq;
+  const struct Pokemon *src = pokegen_ring_claim(ring, &seq);
+
+  if(src == NULL) return false;
+  memcpy(dest, src, sizeof(*dest));
+  pokegen_ring_release(ring, seq);
+  return true;
+}
+
+// Unmap a ring, leaving its shared memory for anyone else using it
+void pokegen_ring_close(struct Ring *ring) {
+  munmap(ring->header, ring->size);
+}
@@ -0,0 +1,636 @@
+/* Generation 3 Pokémon Data Structure Generator
+ * Copyright © 2017 Ethan Welker (nuew)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/* libpokegen: building, encrypting and decoding Generation Ⅲ pokémon
+ * Every function is reentrant; nothing is kept between calls except in the
+ * structures and random state passed to it. Nothing is printed: a function
+ * that fails says so in its return value, and pokegen_error() says why. */
+#ifndef POKEGEN_H
+#define POKEGEN_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The functions of the API, which are all libpokegen.so exports; the tables
+// declared here are its own, and pokegen's
+#define POKEGEN_API __attribute__((visibility("default")))
+
+/* Pokémon substructures, unpacked
+ * Fields narrower than a byte in the games are stored here one per byte, and
+ * masked to their widths (the *_BITS constants) when set and when packed, so
+ * nothing depends on how the compiler lays out bitfields or on byte order. */
+#define FIELD_MASK(bits) ((1U << (bits)) - 1)
+
+#define PP_BONUS_BITS 2
+
+struct PPBonus {
+  uint8_t move1;
+  uint8_t move2;
+  uint8_t move3;
+  uint8_t move4;
+};
+
+struct Growth {
+  uint16_t species; 
+  uint16_t held_item;
+  uint32_t experience;
+  struct PPBonus pp_bonus;
+  uint8_t friendship;
+  uint16_t unknown;
+};
+
+struct Attacks {
+  uint16_t moves[4];
+  uint8_t pp[4];
+};
+
+struct Condition {
+  uint8_t hp_ev;
+  uint8_t attack_ev;
+  uint8_t defense_ev;
+  uint8_t speed_ev;
+  uint8_t special_attack_ev;
+  uint8_t special_defense_ev;
+  uint8_t coolness;
+  uint8_t beauty;
+  uint8_t cuteness;
+  uint8_t smartness;
+  uint8_t toughness;
+  uint8_t feel;
+};
+
+#define POKERUS_BITS 4
+
+struct Pokerus {
+  uint8_t days_remaining;
+  uint8_t strain;
+};
+
+#define GAME_COLOSSEUM_BONUS 0
+#define GAME_SAPPHIRE 1
+#define GAME_RUBY 2
+#define GAME_EMERALD 3
+#define GAME_FIRERED 4
+#define GAME_LEAFGREEN 5
+#define GAME_COLOSSEUM_XD 15
+
+#define POKEBALL_MASTER 1
+#define POKEBALL_ULTRA 2
+#define POKEBALL_GREAT 3
+#define POKEBALL_STANDARD 4
+#define POKEBALL_SAFARI 5
+#define POKEBALL_DIVE 7
+#define POKEBALL_NEST 8
+#define POKEBALL_REPEAT 9
+#define POKEBALL_TIMER 10
+#define POKEBALL_LUXURY 11
+#define POKEBALL_PREMIER 12
+
+#define TRAINER_MALE 0
+#define TRAINER_FEMALE 1
+
+#define LEVEL_MET_BITS 7
+#define GAME_MET_BITS 4
+#define POKEBALL_TYPE_BITS 4
+
+struct Origins {
+  uint8_t level_met;
+  uint8_t game_met;
+  uint8_t pokeball_type;
+  uint8_t trainer_gender;
+};
+
+#define ABILITY_PRIMARY 0
+#define ABILITY_SECONDARY 1
+
+#define IV_BITS 5
+
+struct IVs {
+  uint8_t hp;
+  uint8_t attack;
+  uint8_t defense;
+  uint8_t speed;
+  uint8_t special_attack;
+  uint8_t special_defense;
+  uint8_t egg;
+  uint8_t ability;
+};
+
+// Bits of Misc.ribbons; each contest ribbon is a rank from 0 to 4
+#define RIBBON_COOL 0x7
+#define RIBBON_BEAUTY 0x38
+#define RIBBON_CUTE 0x1c0
+#define RIBBON_SMART 0xe00
+#define RIBBON_TOUGH 0x7000
+#define RIBBON_CHAMPION 0x8000
+#define RIBBON_WINNING 0x10000
+#define RIBBON_VICTORY 0x20000
+#define RIBBON_ARTIST 0x40000
+#define RIBBON_EFFORT 0x80000
+#define RIBBON_SPECIAL 0x3f00000 // six event ribbons
+#define RIBBON_OBEDIENCE 0x80000000
+
+struct Misc {
+  struct Pokerus pokerus;
+  uint8_t met_location;
+  struct Origins origins;
+  struct IVs ivs;
+  uint32_t ribbons; // RIBBON_* bits
+};
+
+/* Pokémon struct and associated constants */
+#define NICKNAME_LENGTH (10)
+#define TRAINER_NAME_LENGTH (7)
+#define NAME_TEXT_SIZE(len) ((len) * 3 + 1) // UTF-8 bytes for len characters
+#define DATA_LENGTH (48)
+#define DATUM_LENGTH (12)
+#define DATUM_PER_DATA (DATA_LENGTH / DATUM_LENGTH)
+
+/* Substructure (datum) orderings, selected by personality % DATUM_ORDERS */
+#define DATUM_GROWTH 0
+#define DATUM_ATTACKS 1
+#define DATUM_CONDITION 2
+#define DATUM_MISC 3
+#define DATUM_ORDERS 24
+
+// Byte offset within data of each datum, indexed by [order][DATUM_*]
+extern const uint8_t datum_offset[DATUM_ORDERS][DATUM_PER_DATA];
+// Datum stored at each position within data, indexed by [order][position]
+extern const uint8_t datum_order[DATUM_ORDERS][DATUM_PER_DATA];
+
+#define LANGUAGE_JAPANESE 0x0201
+#define LANGUAGE_ENGLISH 0x0202
+#define LANGUAGE_FRENCH 0x0203
+#define LANGUAGE_ITALIAN 0x0204
+#define LANGUAGE_GERMAN 0x0205
+#define LANGUAGE_KOREAN 0x0206
+#define LANGUAGE_SPANISH 0x0207
+#define LANGUAGE_EGG 0x0601
+
+#define MARKING_BULLET 0
+#define MARKING_SQUARE 1
+#define MARKING_TRIANGLE 2
+#define MARKING_HEART 3
+
+// Bits of Pokemon.status; sleep is the number of turns left
+#define STATUS_SLEEP 0x7
+#define STATUS_POISONED 0x8
+#define STATUS_BURNT 0x10
+#define STATUS_FROZEN 0x20
+#define STATUS_PARALYZED 0x40
+#define STATUS_BAD_POISONED 0x80
+
+/* A party pokémon, laid out as the games store it
+ * Records are encoded in the games' byte order (little-endian) on any host;
+ * the fields outside data are in host byte order until pokegen_encode(), and
+ * again once pokegen_decode() has read them back. Box pokémon are the first
+ * BOX_POKEMON_LENGTH bytes. */
+struct Pokemon {
+  uint32_t personality;
+  uint32_t trainer_id;
+  char nickname[NICKNAME_LENGTH];
+  uint16_t language;
+  char trainer_name[TRAINER_NAME_LENGTH];
+  uint8_t markings;
+  uint16_t checksum;
+  uint16_t unknown;
+  uint8_t data[DATA_LENGTH];
+  uint32_t status; // STATUS_* bits
+  uint8_t level;
+  uint8_t pokerus;
+  uint16_t current_health;
+  uint16_t max_health;
+  uint16_t attack;
+  uint16_t defense;
+  uint16_t speed;
+  uint16_t special_attack;
+  uint16_t special_defense;
+};
+
+_Static_assert(sizeof(struct Pokemon) == 100, "struct Pokemon must be 100 bytes");
+_Static_assert(offsetof(struct Pokemon, language) == 18, "language must be at 18");
+_Static_assert(offsetof(struct Pokemon, checksum) == 28, "checksum must be at 28");
+_Static_assert(offsetof(struct Pokemon, data) == 32, "data must be at 32");
+_Static_assert(offsetof(struct Pokemon, status) == 80, "status must be at 80");
+_Static_assert(offsetof(struct Pokemon, special_defense) == 98, "stats must end at 100");
+
+/* Everything needed to build a pokémon, before conversion and encryption */
+struct Spec {
+  struct Pokemon pkmn;
+  struct Growth growth;
+  struct Attacks attacks;
+  struct Condition condition;
+  struct Misc misc;
+  bool personality_set;
+  bool trainer_id_set;
+  bool seed_set; // if set, personality and IVs come from the RNG
+  uint32_t seed;
+  uint32_t frame;
+  uint8_t method;
+  char nickname[NAME_TEXT_SIZE(NICKNAME_LENGTH)]; // UTF-8
+  char trainer_name[NAME_TEXT_SIZE(TRAINER_NAME_LENGTH)]; // UTF-8
+  uint16_t derive; // DERIVE_* fields not set explicitly
+};
+
+// Pokémon field options without a short equivalent
+// Every long option from OPT_SPEC_FIRST up sets a field, so they must stay above it
+#define OPT_SPEC_FIRST 0x200
+#define OPT_SEED OPT_SPEC_FIRST
+#define OPT_FRAME 0x201
+#define OPT_METHOD 0x202
+
+// Methods of generating wild pokémon from the RNG
+#define METHOD_1 1
+#define METHOD_2 2
+#define METHOD_4 4
+
+/* Generation Ⅲ save files */
+#define SAVE_SIZE 0x20000
+#define SAVE_BLOCKS 2
+#define SAVE_BLOCK_SIZE 0xe000
+#define SECTIONS_PER_BLOCK 14
+#define SECTION_SIZE 0x1000
+#define SECTION_DATA_SIZE 0xf80
+#define SECTION_ID_OFFSET 0xff4
+#define SECTION_CHECKSUM_OFFSET 0xff6
+#define SECTION_SIGNATURE_OFFSET 0xff8
+#define SECTION_INDEX_OFFSET 0xffc
+#define SECTION_SIGNATURE 0x08012025
+
+#define SECTION_TRAINER 0
+#define SECTION_TEAM 1
+#define SECTION_PC 5
+
+#define TRAINER_GAME_CODE_OFFSET 0xac
+#define GAME_CODE_FRLG 1
+#define TEAM_SIZE_OFFSET_RSE 0x234
+#define TEAM_SIZE_OFFSET_FRLG 0x34
+#define PARTY_SIZE 6
+
+#define BOX_POKEMON_LENGTH 80
+#define BOXES 14
+#define BOX_SIZE 30
+#define PC_POKEMON_OFFSET 4
+
+struct Save {
+  uint8_t *map;
+  size_t size;
+  uint8_t *section[SECTIONS_PER_BLOCK]; // current block's sections, by ID
+  size_t team_size_offset;
+  uint16_t dirty; // bit per section ID written to, whose checksum is stale
+};
+
+// A party or PC box slot; index is 0-5 in the party, or box * 30 + slot in the PC
+struct SaveSlot {
+  bool box;
+  size_t index;
+};
+
+/* Personality value search */
+#define NATURES 25
+
+// Constraints on a personality; each is ignored unless its _set flag is
+struct PidQuery {
+  bool nature_set;
+  uint8_t nature;
+  bool order_set;
+  uint8_t order;
+  bool ability_set;
+  uint8_t ability;
+  bool gender_set;
+  bool female;
+  uint8_t gender_threshold; // lowest personality & 0xff that is male
+  bool shiny_set;
+  bool shiny;
+  uint32_t trainer_id;
+};
+
+/* Game data, generated into pokegen-data.c from the data/ tables
+ * Names are looked up ignoring case and anything but letters and digits, so
+ * "Mr. Mime", "mr-mime" and "MRMIME" are all the same species. */
+#define NAME_KEY_MAX 32
+
+struct NameTable {
+  const char *const *names;
+  const char *const *keys; // names as they are compared, folded by name_key()
+  const uint16_t *values; // of each name
+  size_t count;
+  const uint16_t *seeds; // hash seed of each bucket, which picks the slot
+  size_t buckets;
+  const uint16_t *slots; // index + 1 into names, or 0 if no name hashes there
+  size_t size; // a power of two
+};
+
+extern const struct NameTable species_table, items_table, moves_table, abilities_table,
+  locations_table, games_table, balls_table, languages_table, growth_table;
+
+#define SPECIES_COUNT 413
+#define MOVES_COUNT 355
+#define MAX_LEVEL 100
+#define GROWTH_RATES 6
+
+// Stats in the order the games store them
+#define STAT_HP 0
+#define STAT_ATTACK 1
+#define STAT_DEFENSE 2
+#define STAT_SPEED 3
+#define STAT_SPECIAL_ATTACK 4
+#define STAT_SPECIAL_DEFENSE 5
+#define STATS 6
+
+struct SpeciesInfo {
+  uint8_t base_stats[STATS];
+  uint8_t growth_rate; // value in growth_table
+};
+
+extern const struct SpeciesInfo species_info[SPECIES_COUNT];
+extern const uint8_t move_pp[MOVES_COUNT]; // without PP Ups
+// Total experience at which each growth rate reaches each level
+extern const uint32_t experience_table[GROWTH_RATES][MAX_LEVEL + 1];
+
+#define ITEMS_COUNT 377
+#define GAMES 16 // game_met is four bits
+#define LOCATIONS 256
+
+// Bitsets are arrays of 32 bit words
+#define BITSET_WORDS(bits) (((bits) + 31) / 32)
+#define BITSET_TEST(set, bit) (((set)[(bit) / 32] >> ((bit) % 32)) & 1)
+
+// Where and how pokémon from a game of origin can have been met
+struct GameRules {
+  uint32_t locations[BITSET_WORDS(LOCATIONS)];
+  uint16_t balls; // bit per ball; none if the game is unknown
+};
+
+extern const uint32_t legal_species[BITSET_WORDS(SPECIES_COUNT)];
+extern const uint32_t legal_items[BITSET_WORDS(ITEMS_COUNT)];
+// Species with a learnset in data/learnsets.txt
+extern const uint32_t learnsets_known[BITSET_WORDS(SPECIES_COUNT)];
+// Moves each species can know; every move, for species without a learnset
+extern const uint32_t learnsets[SPECIES_COUNT][BITSET_WORDS(MOVES_COUNT)];
+extern const struct GameRules game_rules[GAMES];
+
+/* Derived fields
+ * Fields the games compute from the rest of a pokémon, rather than store
+ * independently. A spec derives each of these unless it's set explicitly. */
+#define DERIVE_LEVEL 0x1 // from experience
+#define DERIVE_EXPERIENCE 0x2 // from level
+#define DERIVE_PP 0x4
+#define DERIVE_HP 0x8 // current HP, as max HP
+#define DERIVE_MAX_HP 0x10
+#define DERIVE_ATTACK 0x20
+#define DERIVE_DEFENSE 0x40
+#define DERIVE_SPEED 0x80
+#define DERIVE_SPECIAL_ATTACK 0x100
+#define DERIVE_SPECIAL_DEFENSE 0x200
+#define DERIVE_STATS 0x3f0
+#define DERIVE_ALL 0x3ff
+
+/* Templates
+ * A pokémon built and encoded once, to stamp out variants of. Names and stats
+ * a variant shares with the template are copied rather than converted and
+ * calculated again; if it also has the same personality and trainer ID, only
+ * the substructures that differ are encrypted again, and the checksum adjusted
+ * by the difference. */
+struct Template {
+  struct Pokemon built; // as pokegen_build() left it, before encoding
+  struct Pokemon pkmn; // encoded
+  char nickname[NAME_TEXT_SIZE(NICKNAME_LENGTH)];
+  char trainer_name[NAME_TEXT_SIZE(TRAINER_NAME_LENGTH)];
+  uint16_t species;
+  uint16_t checksum;
+  bool stats_valid; // stat was calculated
+  int32_t stat[STATS];
+};
+
+/* Legality checks
+ * Problems that make a pokémon one the games couldn't have produced */
+#define ILLEGAL_SPECIES 0x1 // unused index, or an egg's placeholder
+#define ILLEGAL_ITEM 0x2
+#define ILLEGAL_LEVEL 0x4 // out of range, or not the level experience reaches
+#define ILLEGAL_MOVES 0x8 // none, unknown, repeated, or not in the learnset
+#define ILLEGAL_PP 0x10 // more than the move's full PP
+#define ILLEGAL_EVS 0x20 // more than 510 in total
+#define ILLEGAL_ABILITY 0x40 // not the slot the personality picks
+#define ILLEGAL_GAME 0x80
+#define ILLEGAL_LOCATION 0x100 // not a location of the game
+#define ILLEGAL_BALL 0x200 // not a ball of the game, or not a poké ball if hatched
+#define ILLEGAL_MET_LEVEL 0x400 // above the level
+#define ILLEGAL_EGG 0x800 // an egg met above level 0
+#define ILLEGAL_KINDS 12
+#define EV_TOTAL_MAX 510
+
+/* Shared memory ring
+ * A single producer publishes records into a ring of slots in POSIX shared
+ * memory, and any number of consumers each claim the next one. A slot's seq
+ * is the sequence number it can next be written at, or that plus one once
+ * its record is readable, so neither side needs a lock or a system call. */
+#define RING_MAGIC 0x676e6972 // "ring"
+#define RING_VERSION 1
+#define RING_SLOTS_DEFAULT 4096
+#define RING_SLOTS_MAX (1UL << 24)
+#define RING_CACHE_LINE 64
+
+// What the producer does with a record when the ring is full
+#define RING_WAIT 0 // wait for a consumer to free its slot
+#define RING_DROP 1 // count it in dropped, and move on
+
+struct RingSlot {
+  atomic_uint_least64_t seq;
+  struct Pokemon pkmn;
+};
+
+// The start of the shared memory, followed by the slots
+struct RingHeader {
+  atomic_uint_least32_t magic; // RING_MAGIC, once the rest is initialised
+  uint32_t version;
+  uint32_t record_size; // sizeof(struct Pokemon)
+  uint32_t slot_size; // sizeof(struct RingSlot)
+  uint32_t slots; // a power of two
+  uint32_t policy;
+  atomic_bool closed; // set once the producer is done publishing
+  atomic_uint_least64_t dropped;
+  _Alignas(RING_CACHE_LINE) atomic_uint_least64_t head; // next sequence number to publish
+  _Alignas(RING_CACHE_LINE) atomic_uint_least64_t tail; // next sequence number to claim
+  _Alignas(RING_CACHE_LINE) struct RingSlot slot[];
+};
+
+struct Ring {
+  struct RingHeader *header;
+  size_t size;
+};
+
+/* Corpus archives
+ * Records stored decrypted, a column per field, in blocks of ARCHIVE_BLOCK
+ * records. Each column of a block is frame of reference coded: its values
+ * less the block's least, packed into just enough bits for the largest. With
+ * every value a fixed number of bits into its column, any one record can be
+ * read without decoding the rest of its block.
+ *   header: u32 magic, u32 version, u64 records, u32 block records,
+ *           u32 columns, u32 record size, u32 reserved, u64 index offset,
+ *           then zeroes up to ARCHIVE_HEADER_SIZE
+ *   blocks: each column's packed values, then ARCHIVE_PADDING zero bytes
+ *   index:  for each block, for each column, u64 offset, u64 least value,
+ *           u8 bits per value, then 7 zero bytes
+ * Integers are little endian, like the records. */
+#define ARCHIVE_MAGIC 0x72616b70 // "pkar"
+#define ARCHIVE_VERSION 1
+#define ARCHIVE_BLOCK 4096
+#define ARCHIVE_HEADER_SIZE 64
+#define ARCHIVE_ENTRY_SIZE 24
+#define ARCHIVE_PADDING 8 // so any value can be read with one 8 byte load and a byte more
+#define ARCHIVE_COLUMNS 37
+
+// A field of a record laid out plainly, with its data decrypted and in the
+// order growth, attacks, condition, misc; columns cover all of its bytes
+struct ArchiveColumn {
+  const char *name;
+  uint8_t offset;
+  uint8_t size; // 1 to 8 bytes
+};
+
+extern const struct ArchiveColumn archive_columns[ARCHIVE_COLUMNS];
+
+struct ArchiveWriter {
+  FILE *file;
+  const char *path;
+  uint8_t *plain; // the block being gathered, as plain records
+  size_t n; // records in it
+  uint64_t records;
+  uint64_t offset; // where the next block goes
+  uint8_t *index;
+  size_t index_len, index_cap;
+};
+
+struct Archive {
+  const uint8_t *map;
+  size_t size;
+  uint64_t records;
+  const uint8_t *index;
+};
+
+#define ARCHIVE_ALL_COLUMNS ((1ULL << ARCHIVE_COLUMNS) - 1)
+
+/* Record queries
+ * A query is a comma separated list of terms, every one of which a record must
+ * match, each a field, a comparison (= != < <= > >=) and a value, or just a
+ * field, which matches when it isn't 0. Terms are compiled to a range of
+ * values to be in, or out of, and matched a block of plain records at a time. */
+#define QUERY_TERMS 32
+#define QUERY_BLOCK 1024
+
+struct QueryTerm {
+  uint8_t field; // index in query_fields
+  bool invert; // match values outside the range instead
+  uint32_t least; // the range is least to least + span
+  uint32_t span;
+};
+
+struct Query {
+  struct QueryTerm term[QUERY_TERMS];
+  size_t terms;
+  uint64_t columns; // bit per archive column the terms read
+};
+
+/* Errors */
+POKEGEN_API const char *pokegen_error(void);
+
+/* Building and decoding */
+POKEGEN_API uint32_t pokegen_random(uint64_t *state);
+POKEGEN_API void pokegen_spec_init(struct Spec *spec);
+POKEGEN_API bool pokegen_spec_set(struct Spec *spec, int c, char *arg);
+POKEGEN_API bool pokegen_build(const struct Spec *spec, uint64_t *rng, struct Pokemon *dest);
+POKEGEN_API void pokegen_encode(struct Pokemon *pkmn, size_t n);
+POKEGEN_API bool pokegen_decode(struct Spec *spec, const struct Pokemon *src);
+POKEGEN_API bool pokegen_template_build(struct Template *t, const struct Spec *spec,
+                                        uint64_t *rng);
+POKEGEN_API bool pokegen_template_stamp(const struct Template *t, const struct Spec *spec,
+                                        uint64_t *rng, struct Pokemon *dest);
+
+/* Random number generator */
+POKEGEN_API bool pokegen_lcg_generate(uint32_t seed, uint32_t frame, unsigned method,
+                                      uint32_t *personality, struct IVs *ivs);
+POKEGEN_API size_t pokegen_lcg_find_seeds(uint32_t personality, const struct IVs *ivs,
+                                          uint32_t *seeds, uint8_t *methods, size_t max);
+
+/* Save files */
+POKEGEN_API bool pokegen_save_open(struct Save *save, const char *path, bool writable);
+POKEGEN_API bool pokegen_save_close(struct Save *save);
+POKEGEN_API bool pokegen_save_read(const struct Save *save, struct SaveSlot slot,
+                                   struct Pokemon *pkmn);
+POKEGEN_API bool pokegen_save_write(struct Save *save, struct SaveSlot slot,
+                                    const struct Pokemon *pkmn);
+POKEGEN_API size_t pokegen_save_write_boxes(struct Save *save, size_t index,
+                                            struct Pokemon *pkmn, size_t n);
+POKEGEN_API bool pokegen_save_slot_parse(struct SaveSlot *slot, const char *arg);
+
+/* Personality search */
+POKEGEN_API bool pokegen_pid_search(const struct PidQuery *query, unsigned long limit,
+                                    unsigned threads, FILE *out, unsigned long *found);
+POKEGEN_API bool pokegen_pid_query_parse(struct PidQuery *query, char *arg);
+
+/* Derived fields */
+POKEGEN_API uint8_t pokegen_level(uint8_t growth_rate, uint32_t experience);
+POKEGEN_API void pokegen_derive_records(struct Pokemon *pkmn, size_t n);
+
+/* Legality checks */
+POKEGEN_API uint32_t pokegen_check(const struct Spec *spec, uint32_t *unchecked);
+
+/* Random pokémon */
+POKEGEN_API uint64_t pokegen_stream(uint64_t seed, uint64_t index);
+POKEGEN_API void pokegen_randomize(struct Spec *spec, uint64_t *rng);
+
+/* Memory dump scanning */
+POKEGEN_API bool pokegen_scan_dump(const uint8_t *dump, size_t len, unsigned threads,
+                                   size_t **hits, size_t *found);
+
+/* Corpus archives */
+POKEGEN_API bool pokegen_archive_create(struct ArchiveWriter *w, const char *path);
+POKEGEN_API bool pokegen_archive_append(struct ArchiveWriter *w, const struct Pokemon *pkmn,
+                                        size_t n);
+POKEGEN_API bool pokegen_archive_finish(struct ArchiveWriter *w);
+POKEGEN_API bool pokegen_archive_open(struct Archive *a, const char *path);
+POKEGEN_API uint64_t pokegen_archive_value(const struct Archive *a, uint64_t record,
+                                           size_t column);
+POKEGEN_API void pokegen_archive_gather(const struct Archive *a, uint64_t first, size_t n,
+                                        uint64_t columns, uint8_t *plain);
+POKEGEN_API void pokegen_archive_records(const struct Archive *a, uint64_t first, size_t n,
+                                         struct Pokemon *dest);
+POKEGEN_API void pokegen_archive_close(struct Archive *a);
+
+/* Record queries */
+POKEGEN_API void pokegen_plain(uint8_t *plain, const struct Pokemon *src, size_t n);
+POKEGEN_API bool pokegen_query_parse(struct Query *q, char *arg);
+POKEGEN_API size_t pokegen_query_match(const struct Query *q, const uint8_t *plain, size_t n,
+                                       uint8_t *match);
+
+/* Shared memory ring */
+POKEGEN_API bool pokegen_ring_create(struct Ring *ring, const char *name, uint32_t slots,
+                                     uint32_t policy);
+POKEGEN_API size_t pokegen_ring_publish(struct Ring *ring, const struct Pokemon *pkmn, size_t n);
+POKEGEN_API void pokegen_ring_finish(struct Ring *ring);
+POKEGEN_API bool pokegen_ring_open(struct Ring *ring, const char *name);
+POKEGEN_API const struct Pokemon *pokegen_ring_claim(struct Ring *ring, uint64_t *seq);
+POKEGEN_API void pokegen_ring_release(struct Ring *ring, uint64_t seq);
+POKEGEN_API bool pokegen_ring_consume(struct Ring *ring, struct Pokemon *dest);
+POKEGEN_API void pokegen_ring_close(struct Ring *ring);
+
+#endif
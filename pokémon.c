@@ -15,1071 +15,2687 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#define _GNU_SOURCE
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stdbool.h>
-#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/un.h>
 
-struct PPBonus {
-  uint8_t move1:2;
-  uint8_t move2:2;
-  uint8_t move3:2;
-  uint8_t move4:2;
+#include "pokegen.h"
+
+// Print why this thread's last failed libpokegen call failed
+// returns false, for callers to pass on
+static bool library_error(void) {
+  fprintf(stderr, "%s\n", pokegen_error());
+  return false;
+}
+
+/* Buffered output
+ * Output is formatted straight into one large buffer, which is written out
+ * with a single system call whenever it fills, rather than through stdio. */
+#define OUTBUF_SIZE (1 << 16)
+#define HEXDUMP_LINE_MAX 96
+
+struct Outbuf {
+  int fd;
+  bool error; // a write has failed; anything more is discarded
+  size_t len;
+  char buf[OUTBUF_SIZE];
+};
+
+static const char hex_digits[16] = "0123456789abcdef";
+// Two hex digits for each byte value
+static const char hex_pairs[2 * 256 + 1] =
+  "000102030405060708090a0b0c0d0e0f"
+  "101112131415161718191a1b1c1d1e1f"
+  "202122232425262728292a2b2c2d2e2f"
+  "303132333435363738393a3b3c3d3e3f"
+  "404142434445464748494a4b4c4d4e4f"
+  "505152535455565758595a5b5c5d5e5f"
+  "606162636465666768696a6b6c6d6e6f"
+  "707172737475767778797a7b7c7d7e7f"
+  "808182838485868788898a8b8c8d8e8f"
+  "909192939495969798999a9b9c9d9e9f"
+  "a0a1a2a3a4a5a6a7a8a9aaabacadaeaf"
+  "b0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+  "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf"
+  "d0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+  "e0e1e2e3e4e5e6e7e8e9eaebecedeeef"
+  "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+// Write all of iov to fd, continuing after partial writes
+// returns false if a write fails
+static bool write_all(int fd, struct iovec *iov, int iovcnt) {
+  while(iovcnt > 0) {
+    ssize_t n = writev(fd, iov, iovcnt);
+    if(n < 0) {
+      if(errno == EINTR) continue;
+      return false;
+    }
+
+    // skip whatever was written
+    while(iovcnt > 0 && (size_t) n >= iov->iov_len) {
+      n -= (ssize_t) iov->iov_len;
+      iov++;
+      iovcnt--;
+    }
+    if(iovcnt > 0) {
+      iov->iov_base = (char *) iov->iov_base + n;
+      iov->iov_len -= (size_t) n;
+    }
+  }
+
+  return true;
+}
+
+// Write out the buffer, followed by len bytes of extra if it isn't NULL
+// returns false (after complaining, once) if output has failed
+static bool outbuf_flush_with(struct Outbuf *ob, const void *extra, size_t len) {
+  struct iovec iov[2] = {
+    {.iov_base = ob->buf, .iov_len = ob->len},
+    {.iov_base = (void *) extra, .iov_len = extra != NULL ? len : 0}
+  };
+
+  if(!ob->error && !write_all(ob->fd, iov, 2)) {
+    perror("write");
+    ob->error = true;
+  }
+  ob->len = 0;
+  return !ob->error;
+}
+
+static bool outbuf_flush(struct Outbuf *ob) {
+  return outbuf_flush_with(ob, NULL, 0);
+}
+
+// Make room for at least len (up to OUTBUF_SIZE) more bytes
+// returns where to put them; the caller adds what it uses to ob->len
+static char *outbuf_reserve(struct Outbuf *ob, size_t len) {
+  if(OUTBUF_SIZE - ob->len < len) outbuf_flush(ob);
+  return ob->buf + ob->len;
+}
+
+static void outbuf_write(struct Outbuf *ob, const void *data, size_t len) {
+  if(OUTBUF_SIZE - ob->len < len) {
+    outbuf_flush_with(ob, data, len);
+    return;
+  }
+  memcpy(ob->buf + ob->len, data, len);
+  ob->len += len;
+}
+
+static void outbuf_puts(struct Outbuf *ob, const char *s) {
+  outbuf_write(ob, s, strlen(s));
+}
+
+static void outbuf_putc(struct Outbuf *ob, char c) {
+  *outbuf_reserve(ob, 1) = c;
+  ob->len++;
+}
+
+// Put value in hex, with at least digits digits, at p
+// returns the end of what was put
+static char *put_hex(char *p, unsigned long value, int digits) {
+  char buf[2 * sizeof(value)];
+  int n = 0;
+
+  do {
+    buf[n++] = hex_digits[value & 0xf];
+    value >>= 4;
+  } while(value != 0 || n < digits);
+
+  while(n > 0) *p++ = buf[--n];
+  return p;
+}
+
+// Output block addr, of size len, as an xxd style hexdump.
+// offset is the offset of the starting bit numbers
+static void outbuf_hexdump(struct Outbuf *ob, const void *addr, size_t len, size_t offset) {
+  const uint8_t *bytes = (const uint8_t *) addr;
+
+  for(size_t line = 0; line < len; line += 16) {
+    size_t n = len - line < 16 ? len - line : 16;
+    char *start = outbuf_reserve(ob, HEXDUMP_LINE_MAX), *p = start;
+
+    p = put_hex(p, offset + line, 8);
+    *p++ = ':';
+    for(size_t i = 0; i < n; i++) {
+      p[0] = ' ';
+      memcpy(p + 1, &hex_pairs[2 * bytes[line + i]], 2);
+      p += 3;
+    }
+    memset(p, ' ', (16 - n) * 3 + 2);
+    p += (16 - n) * 3 + 2;
+
+    for(size_t i = 0; i < n; i++) {
+      uint8_t c = bytes[line + i];
+      p[i] = (c < 0x20 || c > 0x7e) ? '.' : (char) c;
+    }
+    p += n;
+    *p++ = '\n';
+
+    ob->len += (size_t) (p - start);
+  }
+}
+
+// Long options without a short equivalent
+#define OPT_BATCH 0x100
+#define OPT_DECODE 0x101
+#define OPT_JSON 0x102
+#define OPT_SAVE 0x103
+#define OPT_SLOT 0x104
+#define OPT_FILL_BOXES 0x105
+#define OPT_FIND_PID 0x106
+#define OPT_LIMIT 0x107
+#define OPT_THREADS 0x108
+#define OPT_FIND_SEED 0x109
+#define OPT_FORMAT 0x10a
+#define OPT_ADDRESS 0x10b
+#define OPT_INJECT_PID 0x10c
+#define OPT_STAND_IN 0x10d
+#define OPT_SERVE 0x10e
+#define OPT_RING_SLOTS 0x10f
+#define OPT_RING_FULL 0x110
+#define OPT_CHECK 0x111
+#define OPT_SCAN 0x112
+#define OPT_RANDOM 0x113
+#define OPT_RANDOM_SEED 0x114
+#define OPT_RANDOM_FIRST 0x115
+#define OPT_EXTRACT 0x116
+#define OPT_FIRST 0x117
+#define OPT_QUERY 0x118
+
+static const char optstring[] = 
+  "12a:A:b:B:c:C:d:D:e:E:f:F:gG:hH:i:I:j:k:K:l:L:"
+  "m:M:n:N:oOp:P:q:Q:r:R:s:S:t:T:u:U:v:V:x:y:Y:";
+static const char usage[] = 
+  "Usage: %s [options] <pokémon name> <trainer name>\n"
+  "       %s [options] --batch[=<file>] [<pokémon name> <trainer name>]\n"
+  "       %s [options] --serve <socket> [<pokémon name> <trainer name>]\n"
+  "       %s [options] --random <n> [--random-seed <s>] [<pokémon name> <trainer name>]\n"
+  "       %s --decode[=<file>] [--json]\n"
+  "       %s --check[=<file>] [--json]\n"
+  "       %s --scan <file> [--json] [--threads <n>]\n"
+  "       %s [output options] --extract <archive> [--first <i>] [--limit <n>]\n"
+  "       %s --query <term>[,...] [--json] [--threads <n>] [<file>...]\n"
+  "       %s [--trainer <id>:<gender>] --find-pid <constraint>[,...] [--limit <n>]\n"
+  "       %s --personality <personality> [IV options] --find-seed\n"
+  "\n"
+  "\t-s, --species <index|name>   The pokémon's species, by index number or name.\n"
+  "\t                         The default is 1 [Bulbasaur].\n"
+  "\t-i, --item <index|name>  The item to be held, by index number or name.\n"
+  "\t                         The default is 0 [Nothing].\n"
+  "\t-x, --experience <int>   The amount of experience that the pokémon shall have.\n"
+  "\t                         The default is the least needed for its level.\n"
+  "\t-B, --pp-bonus <a>:<b>:<c>:<d>   A set of values from 1-3 of how many\n"
+  "\t                                 PP-Bonuses shall have been applied to\n"
+  "\t                                 each move slot. Each defaults to 0.\n"
+  "\t-f, --friendship <int>   The friendship of the generated pokémon.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-m, --moves <a>:<b>:<c>:<d>  The moves the pokémon shall have, by index\n"
+  "\t                             number or name.\n"
+  "\t-P, --moves-pp <a>:<b>:<c>:<d>   The current PP of each move slot.\n"
+  "\t                                 The default is each move's full PP.\n"
+  "\t-j, --ev-hp <int>        The pokémon's HP effort value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-v, --ev-attack <int>    The pokémon's attack effort value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-e, --ev-defense <int>   The pokémon's defense effort value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-V, --ev-speed <int>     The pokémon's speed effort value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-K, --ev-special-attack <int>    The pokémon's special attack effort value.\n"
+  "\t                                 Must be between 0-255; the default is 255.\n"
+  "\t-E, --ev-special-defense <int>   The pokémon's HP effort value.\n"
+  "\t                                 Must be between 0-255; the default is 255.\n"
+  "\t-c, --coolness <int>   The pokémon's coolness condition.\n"
+  "\t                       Must be between 0-255; the default is 255.\n"
+  "\t-y, --beauty <int>     The pokémon's beauty condition.\n"
+  "\t                       Must be between 0-255; the default is 255.\n"
+  "\t-C, --cuteness <int>   The pokémon's cuteness condition.\n"
+  "\t                       Must be between 0-255; the default is 255.\n"
+  "\t-r, --smartness <int>  The pokémon's smartness condition.\n"
+  "\t                       Must be between 0-255; the default is 255.\n"
+  "\t-T, --toughness <int>  The pokémon's toughness condition.\n"
+  "\t                       Must be between 0-255; the default is 255.\n"
+  "\t-F, --feel <int>       The pokémon's feel (also known as luster).\n"
+  "\t                       Must be between 0-255; the default is 0.\n"
+  "\t-R, --pokerus <days remaining>:<strain>  Set pokérus status.\n"
+  "\t                       Both may be between 0-15; the defaults are 0.\n"
+  "\t-k, --met-location <index|name>   Set the location the pokémon was met at.\n"
+  "\t                             The default is 255 [fateful encounter].\n"
+  "\t-M, --met-level <int>    Set the level the pokémon was met at.\n"
+  "\t                         Must be between 1-100; the default is 1.\n"
+  "\t-G, --met-game <colosseum-bonus|sapphire|ruby|emerald|firered|leafgreen|colosseum-xd>\n"
+  "\t                         Set the game the pokémon was met in.\n"
+  "\t-b, --pokeball <master|ultra|great|standard|safari|net|dive|nest|repeat|timer|luxury|premier>\n"
+  "\t                         Set the pokéball that the pokémon was caught in.\n"
+  "\t-H, --iv-hp <int>        The pokémon's HP initial value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-a, --iv-attack <int>    The pokémon's HP initial value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-d, --iv-defense <int>   The pokémon's HP initial value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-S, --iv-speed <int>     The pokémon's HP initial value.\n"
+  "\t                         Must be between 0-255; the default is 255.\n"
+  "\t-A, --iv-special-attack <int>    The pokémon's HP initial value.\n"
+  "\t                                 Must be between 0-255; the default is 255.\n"
+  "\t-D, --iv-special-defense <int>   The pokémon's HP initial value.\n"
+  "\t                                 Must be between 0-255; the default is 255.\n"
+  "\t-g, --egg                The pokémon will be generated as an egg.\n"
+  "\t-1, --ability-primary    The pokémon will use it's primary ability.\n"
+  "\t-2, --ability-secondary  The pokémon will use it's secondary ability.\n"
+  "\t-p, --personality <personality>  The pokémon's personality.\n"
+  "\t                                 Must be an integer between 0-4,294,967,295.\n"
+  "\t                                 The default is a random number in that range.\n"
+  "\t-t, --trainer <trainer id>:<male|female>   The pokémon's trainer's id and gender.\n"
+  "\t                                           The trainer ID must be an integer between\n"
+  "\t                                           0-4,294,967,295. The default is a random number\n"
+  "\t                                           in that range and male.\n"
+  "\t-N, --met-language <ja|en|fr|it|de|ko|es>  The language the pokémon was met in.\n"
+  "\t                                           The default is en [English].\n"
+  "\t-l, --level <int>          The pokémon's level.\n"
+  "\t                           Must be between 1-100; the default is 1, or the\n"
+  "\t                           level reached with --experience if that's given.\n"
+  "\t    --seed <seed>          Generate the personality and IVs from the game's\n"
+  "\t                           random number generator, starting from seed.\n"
+  "\t    --frame <n>            The frame to generate at. The default is 1.\n"
+  "\t    --method <1|2|4>       The wild pokémon generation method. The default is 1.\n"
+  "\t-Y, --pokerus-left <int>   Time remaining in pokérus infection.\n"
+  "\t-L, --hp <int>             Current HP. The default is the maximum HP.\n"
+  "\t-n, --max-hp <int>         Maximum HP.\n"
+  "\t-q, --attack <int>         Attack stat.\n"
+  "\t-u, --defense <int>        Defense stat.\n"
+  "\t-I, --speed <int>          Speed stat.\n"
+  "\t-Q, --special-attack <int>   Special Attack stat.\n"
+  "\t-U, --special-defense <int>  Special Defense stat.\n"
+  "\t                           Each stat defaults to what the game calculates\n"
+  "\t                           from the species, level, nature, IVs and EVs.\n"
+  "\t-o, --raw                  Output as raw bytes.\n"
+  "\t-O, --dump                 Output as a hexdump.\n"
+  "\t    --format <format>      Output as one of:\n"
+  "\t                             hexdump, raw\n"
+  "\t                             gdb                 gdb commands setting memory\n"
+  "\t                             gdb-restore:<file>  the memory image in file, and\n"
+  "\t                                                 a gdb command restoring it\n"
+  "\t                             ips                 an IPS patch\n"
+  "\t                             bps:<source>        a BPS patch of source\n"
+  "\t                             ring:<name>         records published into a\n"
+  "\t                                                 shared memory ring\n"
+  "\t                             archive:<file>      a columnar corpus archive\n"
+  "\t                           Patches apply to a dump of the memory region\n"
+  "\t                           (address & 0xff000000) the pokémon are in.\n"
+  "\t    --address <address>    Where the (first) pokémon goes in memory.\n"
+  "\t                           The default is 0x030043c4.\n"
+  "\t    --inject-pid <pid>[:<base>]\n"
+  "\t                           Write straight into the memory of process pid (an\n"
+  "\t                           emulator, which maps the region of --address at\n"
+  "\t                           base), and read back to verify, instead of\n"
+  "\t                           outputting. Batches are written a chunk at a time.\n"
+  "\t    --ring-slots <n>       How many records the ring holds; a power of two.\n"
+  "\t                           The default is 4096.\n"
+  "\t    --ring-full <wait|drop>  Whether to wait for a consumer or drop records\n"
+  "\t                             when the ring is full. The default is wait.\n"
+  "\t    --stand-in <count>     Map fake EWRAM and IWRAM, output our pid, and once\n"
+  "\t                           stdin closes output the count pokémon at --address.\n"
+  "\t-h, --help                 Display this message.\n"
+  "\t    --batch[=<file>]       Read one spec per line from file (or stdin) and\n"
+  "\t                           output one pokémon per spec. A spec is a list of\n"
+  "\t                           whitespace separated <long option>=<value> pairs\n"
+  "\t                           (or bare flags, e.g. egg), plus nickname=<name>\n"
+  "\t                           and trainer-name=<name>. Unset fields take the\n"
+  "\t                           values given on the command line.\n"
+  "\t    --decode[=<file>]      Decrypt, verify and print each 100 byte pokémon in\n"
+  "\t                           file (or stdin) as a line of key=value pairs.\n"
+  "\t    --json                 Print decoded pokémon as JSON, one per line.\n"
+  "\t    --check[=<file>]       Decrypt each 100 byte pokémon in file (or stdin), and\n"
+  "\t                           print the record number and problems of each that\n"
+  "\t                           the games couldn't have produced.\n"
+  "\t    --scan <file>          Print every pokémon found at any offset of a memory\n"
+  "\t                           dump, as --decode would, after its offset.\n"
+  "\t    --save <file>          Write into a slot of a save file, in place, instead\n"
+  "\t                           of outputting. Batches fill consecutive slots.\n"
+  "\t    --slot <party:<1-6>|box:<1-14>:<1-30>>\n"
+  "\t                           The save file slot to write. The default is party:1,\n"
+  "\t                           or box:1:1 with --fill-boxes.\n"
+  "\t    --fill-boxes <count>   Write count (up to 420) pokémon into consecutive PC\n"
+  "\t                           box slots of the save file, each with a new random\n"
+  "\t                           personality and trainer ID unless they are set.\n"
+  "\t    --find-pid <constraint>[,<constraint>...]\n"
+  "\t                           Output every personality, in order, meeting all of:\n"
+  "\t                             nature=<name|0-24>      order=<datum order 0-23>\n"
+  "\t                             ability=<primary|secondary>\n"
+  "\t                             gender=<male|female>:<species gender threshold>\n"
+  "\t                             shiny[=<yes|no>] (for the --trainer ID)\n"
+  "\t    --limit <n>            Stop after the first n personalities found, or\n"
+  "\t                           pokémon extracted.\n"
+  "\t    --threads <n>          Search, serve, randomise or query with n threads.\n"
+  "\t                           The default is one per CPU.\n"
+  "\t    --extract <archive>    Output the pokémon stored in an archive.\n"
+  "\t    --first <i>            Start extracting at pokémon i, rather than 0.\n"
+  "\t    --query <term>[,<term>...]\n"
+  "\t                           Print, as --decode would, after its file, every\n"
+  "\t                           pokémon in the files (raw records, save files or\n"
+  "\t                           archives; - or none is stdin) matching all of:\n"
+  "\t                             <field><=|!=|<|<=|>|>=><value>, or <field> for\n"
+  "\t                             any but 0. Fields are most keys of --decode,\n"
+  "\t                             plus move (any of the four), nature and shiny,\n"
+  "\t                             e.g. species=pikachu,shiny,iv-speed>=31\n"
+  "\t    --random <n>           Output n pokémon with every field but the names and\n"
+  "\t                           language random, within the games' rules.\n"
+  "\t    --random-seed <s>      The seed of the --random corpus. The same seed gives\n"
+  "\t                           the same pokémon, with any number of --threads.\n"
+  "\t                           The default is printed, to replay the corpus.\n"
+  "\t    --random-first <i>     Start at pokémon i of the corpus, rather than 0.\n"
+  "\t    --find-seed            Output every seed and method whose first frame gives\n"
+  "\t                           the --personality and IVs.\n"
+  "\t    --serve <socket>       Build pokémon for binary requests on a Unix socket,\n"
+  "\t                           on top of the command line's, until interrupted.\n"
+  "\n";
+static const struct option long_options[] = {
+  {"species", required_argument, NULL, 's'},
+  {"item", required_argument, NULL, 'i'},
+  {"experience", required_argument, NULL, 'x'},
+  {"pp-bonus", required_argument, NULL, 'B'},
+  {"friendship", required_argument, NULL, 'f'},
+  {"moves", required_argument, NULL, 'm'},
+  {"moves-pp", required_argument, NULL, 'P'},
+  {"ev-hp", required_argument, NULL, 'j'},
+  {"ev-attack", required_argument, NULL, 'v'},
+  {"ev-defense", required_argument, NULL, 'e'},
+  {"ev-speed", required_argument, NULL, 'V'},
+  {"ev-special-attack", required_argument, NULL, 'K'},
+  {"ev-special-defense", required_argument, NULL, 'E'},
+  {"coolness", required_argument, NULL, 'c'},
+  {"beauty", required_argument, NULL, 'y'},
+  {"cuteness", required_argument, NULL, 'C'},
+  {"smartness", required_argument, NULL, 'r'},
+  {"toughness", required_argument, NULL, 'T'},
+  {"feel", required_argument, NULL, 'F'},
+  {"pokerus", required_argument, NULL, 'R'},
+  {"met-location", required_argument, NULL, 'k'},
+  {"met-level", required_argument, NULL, 'M'},
+  {"met-game", required_argument, NULL, 'G'},
+  {"pokeball", required_argument, NULL, 'b'},
+  {"iv-hp", required_argument, NULL, 'H'},
+  {"iv-attack", required_argument, NULL, 'a'},
+  {"iv-defense", required_argument, NULL, 'd'},
+  {"iv-speed", required_argument, NULL, 'S'},
+  {"iv-special-attack", required_argument, NULL, 'A'},
+  {"iv-special-defense", required_argument, NULL, 'D'},
+  {"egg", no_argument, NULL, 'g'},
+  {"ability-primary", no_argument, NULL, '1'},
+  {"ability-secondary", no_argument, NULL, '2'},
+  {"personality", required_argument, NULL, 'p'},
+  {"trainer", required_argument, NULL, 't'},
+  {"met-language", required_argument, NULL, 'N'},
+  {"level", required_argument, NULL, 'l'},
+  {"seed", required_argument, NULL, OPT_SEED},
+  {"frame", required_argument, NULL, OPT_FRAME},
+  {"method", required_argument, NULL, OPT_METHOD},
+  {"pokerus-left", required_argument, NULL, 'Y'},
+  {"hp", required_argument, NULL, 'L'},
+  {"max-hp", required_argument, NULL, 'n'},
+  {"attack", required_argument, NULL, 'q'},
+  {"defense", required_argument, NULL, 'u'},
+  {"speed", required_argument, NULL, 'I'},
+  {"special-attack", required_argument, NULL, 'Q'},
+  {"special-defense", required_argument, NULL, 'U'},
+  {"raw", no_argument, NULL, 'o'},
+  {"dump", no_argument, NULL, 'O'},
+  {"help", no_argument, NULL, 'h'},
+  {"batch", optional_argument, NULL, OPT_BATCH},
+  {"decode", optional_argument, NULL, OPT_DECODE},
+  {"json", no_argument, NULL, OPT_JSON},
+  {"check", optional_argument, NULL, OPT_CHECK},
+  {"scan", required_argument, NULL, OPT_SCAN},
+  {"save", required_argument, NULL, OPT_SAVE},
+  {"slot", required_argument, NULL, OPT_SLOT},
+  {"fill-boxes", required_argument, NULL, OPT_FILL_BOXES},
+  {"find-pid", required_argument, NULL, OPT_FIND_PID},
+  {"limit", required_argument, NULL, OPT_LIMIT},
+  {"threads", required_argument, NULL, OPT_THREADS},
+  {"find-seed", no_argument, NULL, OPT_FIND_SEED},
+  {"format", required_argument, NULL, OPT_FORMAT},
+  {"address", required_argument, NULL, OPT_ADDRESS},
+  {"inject-pid", required_argument, NULL, OPT_INJECT_PID},
+  {"stand-in", required_argument, NULL, OPT_STAND_IN},
+  {"serve", required_argument, NULL, OPT_SERVE},
+  {"ring-slots", required_argument, NULL, OPT_RING_SLOTS},
+  {"ring-full", required_argument, NULL, OPT_RING_FULL},
+  {"random", required_argument, NULL, OPT_RANDOM},
+  {"random-seed", required_argument, NULL, OPT_RANDOM_SEED},
+  {"random-first", required_argument, NULL, OPT_RANDOM_FIRST},
+  {"extract", required_argument, NULL, OPT_EXTRACT},
+  {"first", required_argument, NULL, OPT_FIRST},
+  {"query", required_argument, NULL, OPT_QUERY},
+  {0, 0, 0, 0}
+};
+
+
+/* Batch generation */
+#define BATCH_RECORDS 256
+#define BATCH_KEYS (sizeof(long_options) / sizeof(*long_options))
+
+static const struct option *batch_keys[BATCH_KEYS];
+static size_t batch_keys_len = 0;
+
+static int batch_key_cmp(const void *a, const void *b) {
+  const struct option *x = *(const struct option * const *) a;
+  const struct option *y = *(const struct option * const *) b;
+  return strcmp(x->name, y->name);
+}
+
+static int batch_key_find(const void *key, const void *elem) {
+  return strcmp((const char *) key, (*(const struct option * const *) elem)->name);
+}
+
+// Whether option val sets a pokémon field, rather than controlling the program
+static bool is_spec_option(int val) {
+  return val > 0xff ? val >= OPT_SPEC_FIRST : strchr("oOh", val) == NULL;
+}
+
+// Sort the pokémon field options once, so each spec key is a binary search
+static void batch_keys_init(void) {
+  for(size_t i = 0; long_options[i].name != NULL; i++) {
+    if(!is_spec_option(long_options[i].val)) continue;
+    batch_keys[batch_keys_len++] = &long_options[i];
+  }
+
+  qsort(batch_keys, batch_keys_len, sizeof(*batch_keys), batch_key_cmp);
+}
+
+// Apply a line of whitespace separated key=value pairs to spec
+// returns false (after complaining) if any pair is invalid
+static bool batch_parse_line(struct Spec *spec, char *line, size_t lineno) {
+  char *p = line;
+
+  for(;;) {
+    while(*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+    if(*p == '\0' || *p == '#') return true;
+
+    char *key = p, *value = NULL;
+    while(*p != '\0' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+      if(*p == '=' && value == NULL) {
+        *p = '\0';
+        value = p + 1;
+      }
+      p++;
+    }
+    if(*p != '\0') *p++ = '\0';
+
+    bool nickname = !strcmp(key, "nickname");
+    if((nickname || !strcmp(key, "trainer-name")) && value != NULL) {
+      char *name = nickname ? spec->nickname : spec->trainer_name;
+      size_t size = nickname ? sizeof(spec->nickname) : sizeof(spec->trainer_name);
+      size_t len = strlen(value);
+      if(len >= size) {
+        fprintf(stderr, "line %zu: %s is longer than %zu bytes\n", lineno, key, size - 1);
+        return false;
+      }
+      memcpy(name, value, len + 1);
+      continue;
+    }
+
+    const struct option **opt = bsearch(
+      key, batch_keys, batch_keys_len, sizeof(*batch_keys), batch_key_find
+    );
+    if(opt == NULL || ((*opt)->has_arg == required_argument) != (value != NULL)) {
+      fprintf(stderr, "line %zu: invalid field '%s'\n", lineno, key);
+      return false;
+    } else if(!pokegen_spec_set(spec, (*opt)->val, value)) {
+      fprintf(stderr, "line %zu: %s\n", lineno, pokegen_error());
+      return false;
+    }
+  }
+}
+
+/* Output of generated pokémon
+ * Record i goes at address + i * 100, so every run of records is one
+ * contiguous block of memory, and is written out as one. */
+#define FORMAT_HEXDUMP 0
+#define FORMAT_RAW 1
+#define FORMAT_GDB 2
+#define FORMAT_GDB_RESTORE 3
+#define FORMAT_IPS 4
+#define FORMAT_BPS 5
+#define FORMAT_INJECT 6
+#define FORMAT_RING 7
+#define FORMAT_ARCHIVE 8
+#define DUMP_OFFSET (0x03004360 + 100)
+
+// IPS and BPS patch a dump of the 16 MiB memory region an address is in
+#define REGION_OFFSET(address) ((address) & 0xffffffUL)
+#define IPS_RECORD_MAX 0xffff
+#define IPS_OFFSET_LIMIT 0x1000000
+#define IPS_EOF 0x454f46
+
+struct Output {
+  struct Outbuf *out;
+  int format;
+  unsigned long address; // where the first record goes
+  const char *file; // the image for gdb-restore, the source for bps, the ring name,
+                    // or the archive
+  FILE *image;
+  uint8_t *target; // bps source, with records written over it
+  size_t source_size, target_size;
+  size_t changed_start, changed_end; // what of target has been written
+  uint32_t source_crc;
+  pid_t pid; // process injected into
+  unsigned long base; // if not 0, where the process maps the address's region
+  struct Save *save; // if not NULL, pokémon are written into its slots instead
+  struct SaveSlot slot; // the next save slot to write
+  struct Ring ring;
+  uint32_t ring_slots;
+  uint32_t ring_policy;
+  struct ArchiveWriter archive;
 };
 
-struct Growth {
-  uint16_t species; 
-  uint16_t held_item;
-  uint32_t experience;
-  struct PPBonus pp_bonus;
-  uint8_t friendship;
-  uint16_t unknown;
-};
+// Parse an output format of the form <name>[:<file>]
+// returns false if it isn't one, or has a file when it shouldn't
+static bool output_format_parse(struct Output *output, char *arg) {
+  static const char *const names[] = {
+    [FORMAT_HEXDUMP] = "hexdump", [FORMAT_RAW] = "raw", [FORMAT_GDB] = "gdb",
+    [FORMAT_GDB_RESTORE] = "gdb-restore", [FORMAT_IPS] = "ips", [FORMAT_BPS] = "bps",
+    [FORMAT_RING] = "ring", [FORMAT_ARCHIVE] = "archive"
+  };
+  char *file = strchr(arg, ':');
+
+  if(file != NULL) *file++ = '\0';
+  for(int i = 0; i < (int) (sizeof(names) / sizeof(*names)); i++) {
+    if(names[i] == NULL || strcmp(arg, names[i]) != 0) continue;
+
+    bool needs_file = i == FORMAT_GDB_RESTORE || i == FORMAT_BPS || i == FORMAT_RING ||
+                      i == FORMAT_ARCHIVE;
+    if(needs_file != (file != NULL && *file != '\0')) return false;
+    output->format = i;
+    output->file = file;
+    return true;
+  }
+  return false;
+}
+
+// CRC-32, as used by BPS, of len bytes at data
+static uint32_t crc32(const uint8_t *data, size_t len) {
+  uint32_t crc = 0xffffffff;
+
+  for(size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for(int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+// Append value to p as a BPS variable length number
+// returns the end of what was appended
+static uint8_t *bps_number(uint8_t *p, uint64_t value) {
+  for(;;) {
+    uint8_t x = value & 0x7f;
+    value >>= 7;
+    if(value == 0) {
+      *p++ = 0x80 | x;
+      return p;
+    }
+    *p++ = x;
+    value--;
+  }
+}
+
+// Read all of the file at path into a new buffer, of *size bytes
+// returns NULL (after complaining) if it can't be read
+static uint8_t *read_file(const char *path, size_t *size) {
+  FILE *f = fopen(path, "rb");
+  uint8_t *buf = NULL;
+  size_t cap = 0, got;
+
+  if(f == NULL) {
+    perror(path);
+    return NULL;
+  }
+
+  *size = 0;
+  do {
+    if(*size == cap) {
+      cap = cap != 0 ? 2 * cap : 1 << 16;
+      uint8_t *grown = realloc(buf, cap);
+      if(grown == NULL) {
+        perror(path);
+        free(buf);
+        fclose(f);
+        return NULL;
+      }
+      buf = grown;
+    }
+    got = fread(buf + *size, 1, cap - *size, f);
+    *size += got;
+  } while(got != 0);
+
+  if(ferror(f)) {
+    perror(path);
+    free(buf);
+    buf = NULL;
+  }
+  fclose(f);
+  return buf;
+}
+
+// Set up output in its format; must be called before the first write
+// returns false (after complaining) if a file it needs can't be used
+static bool output_start(struct Output *output) {
+  switch(output->format) {
+  case FORMAT_GDB_RESTORE:
+    if((output->image = fopen(output->file, "wb")) == NULL) {
+      perror(output->file);
+      return false;
+    }
+    break;
+  case FORMAT_IPS:
+    outbuf_puts(output->out, "PATCH");
+    break;
+  case FORMAT_BPS:
+    if((output->target = read_file(output->file, &output->source_size)) == NULL) {
+      return false;
+    }
+    output->target_size = output->source_size;
+    output->changed_start = SIZE_MAX;
+    output->changed_end = 0;
+    output->source_crc = crc32(output->target, output->source_size);
+    break;
+  case FORMAT_RING:
+    if(!pokegen_ring_create(&output->ring, output->file, output->ring_slots,
+                            output->ring_policy)) {
+      return library_error();
+    }
+    break;
+  case FORMAT_ARCHIVE:
+    if(!pokegen_archive_create(&output->archive, output->file)) return library_error();
+    break;
+  }
+  return true;
+}
+
+// Write len bytes as a gdb command setting memory at address
+static void output_gdb(struct Outbuf *ob, const uint8_t *bytes, size_t len,
+                       unsigned long address) {
+  char *p = outbuf_reserve(ob, 64);
+  ob->len += (size_t) sprintf(p, "set { char [%zu] } 0x%08lx = { ", len, address);
+
+  for(size_t i = 0; i < len; i += sizeof(struct Pokemon)) {
+    size_t n = len - i < sizeof(struct Pokemon) ? len - i : sizeof(struct Pokemon);
+    char *start = outbuf_reserve(ob, 6 * sizeof(struct Pokemon));
+    p = start;
+
+    for(size_t j = i; j < i + n; j++) {
+      memcpy(p, "0x", 2);
+      memcpy(p + 2, &hex_pairs[2 * bytes[j]], 2);
+      memcpy(p + 4, j + 1 < len ? ", " : " }", 2);
+      p += 6;
+    }
+    ob->len += (size_t) (p - start);
+  }
+  outbuf_putc(ob, '\n');
+}
+
+// Write len bytes as IPS records patching offset
+// returns false (after complaining) if they're out of an IPS patch's range
+static bool output_ips(struct Outbuf *ob, const uint8_t *bytes, size_t len, size_t offset) {
+  for(size_t done = 0; done < len;) {
+    size_t n = len - done < IPS_RECORD_MAX ? len - done : IPS_RECORD_MAX;
+    size_t at = offset + done;
+
+    if(at + n > IPS_OFFSET_LIMIT || at == IPS_EOF) {
+      fprintf(stderr, "offset 0x%zx can't be patched by IPS\n", at);
+      return false;
+    }
+
+    uint8_t header[5] = {
+      (uint8_t) (at >> 16), (uint8_t) (at >> 8), (uint8_t) at,
+      (uint8_t) (n >> 8), (uint8_t) n
+    };
+    outbuf_write(ob, header, sizeof(header));
+    outbuf_write(ob, bytes + done, n);
+    done += n;
+  }
+  return true;
+}
+
+// Write len bytes over the target of a BPS patch at offset
+// returns false (after complaining) if the target can't grow to fit them
+static bool output_bps(struct Output *output, const uint8_t *bytes, size_t len, size_t offset) {
+  if(offset + len > output->target_size) {
+    uint8_t *grown = realloc(output->target, offset + len);
+    if(grown == NULL) {
+      perror("bps");
+      return false;
+    }
+    memset(grown + output->target_size, 0, offset + len - output->target_size);
+    output->target = grown;
+    output->target_size = offset + len;
+  }
+
+  memcpy(output->target + offset, bytes, len);
+  if(offset < output->changed_start) output->changed_start = offset;
+  if(offset + len > output->changed_end) output->changed_end = offset + len;
+  return true;
+}
+
+// Write the BPS patch turning the source into the target
+// Everything before and after the written block is read from the source, and
+// anything the target grew by is included with the block.
+static void output_bps_patch(struct Output *output) {
+  size_t start = output->changed_start, end = output->changed_end;
+  if(start > output->source_size) start = output->source_size;
+  if(end < start) end = start;
+
+  uint8_t *patch = malloc(64 + (end - start));
+  uint8_t *p = patch;
+  if(patch == NULL) {
+    perror("bps");
+    output->out->error = true;
+    return;
+  }
+
+  memcpy(p, "BPS1", 4);
+  p = bps_number(p + 4, output->source_size);
+  p = bps_number(p, output->target_size);
+  p = bps_number(p, 0);
+
+  if(start > 0) p = bps_number(p, ((uint64_t) (start - 1) << 2) | 0); // SourceRead
+  if(end > start) {
+    p = bps_number(p, ((uint64_t) (end - start - 1) << 2) | 1); // TargetRead
+    memcpy(p, output->target + start, end - start);
+    p += end - start;
+  }
+  if(output->target_size > end) {
+    p = bps_number(p, ((uint64_t) (output->target_size - end - 1) << 2) | 0);
+  }
+
+  uint32_t crcs[3] = {output->source_crc, crc32(output->target, output->target_size), 0};
+  for(int i = 0; i < 3; i++) {
+    if(i == 2) crcs[2] = crc32(patch, (size_t) (p - patch));
+    for(int j = 0; j < 4; j++) *p++ = (uint8_t) (crcs[i] >> (8 * j));
+  }
+
+  outbuf_write(output->out, patch, (size_t) (p - patch));
+  free(patch);
+}
+
+// Parse the target of --inject-pid, of the form <pid>[:<region base>]
+// returns false if it isn't one
+static bool output_inject_parse(struct Output *output, const char *arg) {
+  char *end;
+  long pid = strtol(arg, &end, 10);
+
+  if(end == arg || pid <= 0 || (*end != '\0' && *end != ':')) return false;
+  output->format = FORMAT_INJECT;
+  output->pid = (pid_t) pid;
+  output->base = *end == ':' ? strtoul(end + 1, NULL, 0) : 0;
+  return true;
+}
+
+// Write len bytes of records into the injected process at address, in one
+// system call, then read them back and check their checksums
+// returns false (after complaining) if any of that fails
+static bool output_inject(struct Output *output, const uint8_t *bytes, size_t len,
+                          unsigned long address) {
+  static uint8_t back[BATCH_RECORDS * sizeof(struct Pokemon)];
+  if(output->base != 0) address = output->base + REGION_OFFSET(address);
+  struct iovec local = {.iov_base = (void *) bytes, .iov_len = len};
+  struct iovec remote = {.iov_base = (void *) address, .iov_len = len};
+  ssize_t n;
+
+  if((n = process_vm_writev(output->pid, &local, 1, &remote, 1, 0)) != (ssize_t) len) {
+    if(n < 0) perror("process_vm_writev");
+    else fprintf(stderr, "only %zd of %zu bytes could be injected at 0x%lx\n", n, len, address);
+    return false;
+  }
+
+  local.iov_base = back;
+  if((n = process_vm_readv(output->pid, &local, 1, &remote, 1, 0)) != (ssize_t) len) {
+    if(n < 0) perror("process_vm_readv");
+    else fprintf(stderr, "only %zd of %zu bytes could be read back at 0x%lx\n", n, len, address);
+    return false;
+  }
+
+  for(size_t i = 0; i < len; i += sizeof(struct Pokemon)) {
+    struct Spec spec;
+    struct Pokemon pkmn;
+
+    memcpy(&pkmn, back + i, sizeof(pkmn));
+    if(!pokegen_decode(&spec, &pkmn) || memcmp(back + i, bytes + i, sizeof(pkmn)) != 0) {
+      fprintf(stderr, "pokémon injected at 0x%lx doesn't read back intact\n", address + i);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Finish output in its format, once everything has been written
+// returns false (after complaining) if anything couldn't be finished
+static bool output_finish(struct Output *output) {
+  char buf[32];
+  bool ok = true;
+
+  switch(output->format) {
+  case FORMAT_GDB_RESTORE:
+    if(fclose(output->image) != 0) {
+      perror(output->file);
+      ok = false;
+    }
+    outbuf_puts(output->out, "restore ");
+    outbuf_puts(output->out, output->file);
+    sprintf(buf, " binary 0x%08lx\n", output->address);
+    outbuf_puts(output->out, buf);
+    break;
+  case FORMAT_IPS:
+    outbuf_puts(output->out, "EOF");
+    break;
+  case FORMAT_BPS:
+    output_bps_patch(output);
+    free(output->target);
+    break;
+  case FORMAT_RING:
+    if(atomic_load(&output->ring.header->dropped) > 0) {
+      fprintf(stderr, "%lu records dropped while the ring was full\n",
+              (unsigned long) atomic_load(&output->ring.header->dropped));
+    }
+    pokegen_ring_finish(&output->ring);
+    break;
+  case FORMAT_ARCHIVE:
+    ok = pokegen_archive_finish(&output->archive) || library_error();
+    break;
+  }
+  return ok;
+}
+
+// Write out n complete pokémon, the first being record number first
+// returns false (after complaining) if they can't be written
+static bool output_write(struct Output *output, const struct Pokemon *pkmn,
+                         size_t n, size_t first) {
+  const uint8_t *bytes = (const uint8_t *) pkmn;
+  size_t len = n * sizeof(struct Pokemon);
+  unsigned long address = output->address + (first * sizeof(struct Pokemon));
+
+  if(output->save != NULL) {
+    for(size_t i = 0; i < n; i++, output->slot.index++) {
+      if(!pokegen_save_write(output->save, output->slot, &pkmn[i])) {
+        fprintf(stderr, "no save slot left for record %zu\n", first + i);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  switch(output->format) {
+  case FORMAT_HEXDUMP:
+    for(size_t i = 0; i < n; i++) {
+      outbuf_hexdump(output->out, &pkmn[i], sizeof(struct Pokemon),
+                     address + (i * sizeof(struct Pokemon)));
+    }
+    break;
+  case FORMAT_RAW:
+    outbuf_write(output->out, bytes, len);
+    break;
+  case FORMAT_GDB:
+    if(len > 0) output_gdb(output->out, bytes, len, address);
+    break;
+  case FORMAT_GDB_RESTORE:
+    if(fwrite(bytes, 1, len, output->image) != len) {
+      perror(output->file);
+      return false;
+    }
+    break;
+  case FORMAT_IPS:
+    return output_ips(output->out, bytes, len,
+                      REGION_OFFSET(output->address) + (first * sizeof(struct Pokemon)));
+  case FORMAT_BPS:
+    return output_bps(output, bytes, len,
+                      REGION_OFFSET(output->address) + (first * sizeof(struct Pokemon)));
+  case FORMAT_INJECT:
+    return len == 0 || output_inject(output, bytes, len, address);
+  case FORMAT_RING:
+    pokegen_ring_publish(&output->ring, pkmn, n);
+    break;
+  case FORMAT_ARCHIVE:
+    if(!pokegen_archive_append(&output->archive, pkmn, n)) return library_error();
+    break;
+  }
+
+  return true;
+}
+
+// Encrypt, unless they're encoded already, and write out a chunk of n
+// pokémon, the first being record number first
+static bool batch_flush(struct Output *output, struct Pokemon *out, size_t n, size_t first,
+                        bool encoded) {
+  if(output->save != NULL && output->slot.box) {
+    size_t written = 0;
+    if(!encoded) {
+      // encrypt straight into the save's PC buffer
+      written = pokegen_save_write_boxes(output->save, output->slot.index, out, n);
+    } else {
+      struct SaveSlot slot = {.box = true, .index = output->slot.index};
+      while(written < n && pokegen_save_write(output->save, slot, &out[written])) {
+        slot.index++;
+        written++;
+      }
+    }
+    output->slot.index += written;
+    if(written < n) {
+      fprintf(stderr, "no save slot left for record %zu\n", first + written);
+      return false;
+    }
+    return true;
+  }
+
+  if(!encoded) pokegen_encode(out, n);
+  return output_write(output, out, n, first);
+}
+
+// Build count pokémon from base, with a new random personality and trainer ID
+// for each unless set
+// returns the exit status
+static int fill_run(const struct Spec *base, uint64_t *rng, size_t count,
+                    struct Output *output) {
+  static struct Pokemon out[BATCH_RECORDS];
+
+  for(size_t total = 0; total < count;) {
+    size_t n = count - total;
+    if(n > BATCH_RECORDS) n = BATCH_RECORDS;
+
+    for(size_t i = 0; i < n; i++) {
+      if(!pokegen_build(base, rng, &out[i])) return !library_error();
+    }
+    if(!batch_flush(output, out, n, total, false)) return 1;
+    total += n;
+  }
+
+  return 0;
+}
+
+// Build a pokémon for every spec line in input, on top of base
+// If base fixes the personality and trainer ID, each line is stamped from a
+// template of base, so only what it changes is encrypted again
+// returns the exit status; stops at the first invalid line
+static int batch_run(const struct Spec *base, uint64_t *rng, FILE *input,
+                     struct Output *output) {
+  static struct Pokemon out[BATCH_RECORDS];
+  static struct Template tmpl;
+  char *line = NULL;
+  size_t cap = 0, lineno = 0, n = 0, total = 0;
+  int status = 0;
+
+  batch_keys_init();
+
+  bool stamp = base->trainer_id_set && (base->personality_set || base->seed_set);
+  if(stamp && !pokegen_template_build(&tmpl, base, rng)) return !library_error();
+
+  while(getline(&line, &cap, input) != -1) {
+    lineno++;
+
+    // skip blank lines and comments
+    char *p = line;
+    while(*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+    if(*p == '\0' || *p == '#') continue;
+
+    struct Spec spec = *base;
+    if(!batch_parse_line(&spec, p, lineno)) {
+      status = 1;
+      break;
+    } else if(!(stamp ? pokegen_template_stamp(&tmpl, &spec, rng, &out[n])
+                      : pokegen_build(&spec, rng, &out[n]))) {
+      fprintf(stderr, "line %zu: %s\n", lineno, pokegen_error());
+      status = 1;
+      break;
+    }
+
+    if(++n == BATCH_RECORDS) {
+      if(!batch_flush(output, out, n, total, stamp)) {
+        n = 0;
+        status = 1;
+        break;
+      }
+      total += n;
+      n = 0;
+    }
+  }
+
+  if(!batch_flush(output, out, n, total, stamp)) status = 1;
+  free(line);
+  return status;
+}
+
+/* Random corpora
+ * Workers claim chunks of pokémon to randomise, build and encrypt, then write
+ * them out in chunk order, so the output is the same for any number of them. */
+struct RandomRun {
+  const struct Spec *base;
+  uint64_t seed;
+  uint64_t first; // index of the first pokémon in the corpus
+  uint64_t count;
+  struct Output *output;
+  atomic_uint_least64_t next_chunk;
+  atomic_bool stop;
+  pthread_mutex_t lock;
+  pthread_cond_t committed;
+  uint64_t commit_chunk; // chunks are written in order
+  bool failed;
+};
+
+// Write out a chunk of n pokémon once all earlier chunks have been, or give
+// up if the run has failed
+// returns false if the run is over
+static bool random_commit(struct RandomRun *run, uint64_t chunk,
+                          struct Pokemon *out, size_t n, bool built) {
+  pthread_mutex_lock(&run->lock);
+  while(run->commit_chunk != chunk && !atomic_load(&run->stop)) {
+    pthread_cond_wait(&run->committed, &run->lock);
+  }
+
+  if(!atomic_load(&run->stop)) {
+    if((!built && !library_error()) ||
+       !batch_flush(run->output, out, n, chunk * BATCH_RECORDS, true)) {
+      run->failed = true;
+      atomic_store(&run->stop, true);
+    }
+    run->commit_chunk++;
+  }
+
+  pthread_cond_broadcast(&run->committed);
+  pthread_mutex_unlock(&run->lock);
+  return !atomic_load(&run->stop);
+}
+
+static void *random_worker(void *arg) {
+  struct RandomRun *run = (struct RandomRun *) arg;
+  struct Pokemon out[BATCH_RECORDS];
+
+  for(;;) {
+    uint64_t chunk = atomic_fetch_add(&run->next_chunk, 1);
+    uint64_t start = chunk * BATCH_RECORDS;
+    if(start >= run->count || atomic_load(&run->stop)) break;
+    size_t n = run->count - start < BATCH_RECORDS ? (size_t) (run->count - start) : BATCH_RECORDS;
+
+    bool built = true;
+    for(size_t i = 0; i < n && built; i++) {
+      struct Spec spec = *run->base;
+      uint64_t rng = pokegen_stream(run->seed, run->first + start + i);
+
+      pokegen_randomize(&spec, &rng);
+      built = pokegen_build(&spec, &rng, &out[i]);
+    }
+    if(built) pokegen_encode(out, n);
+
+    if(!random_commit(run, chunk, out, n, built)) break;
+  }
+
+  return NULL;
+}
+
+// Build count random pokémon on top of base, from index first of the corpus
+// seed, with threads threads
+// returns the exit status
+static int random_run(const struct Spec *base, uint64_t seed, uint64_t first, uint64_t count,
+                      unsigned threads, struct Output *output) {
+  struct RandomRun run = {
+    .base = base,
+    .seed = seed,
+    .first = first,
+    .count = count,
+    .output = output,
+    .commit_chunk = 0,
+    .failed = false
+  };
+  pthread_t *pool = calloc(threads, sizeof(pthread_t));
+
+  atomic_init(&run.next_chunk, 0);
+  atomic_init(&run.stop, false);
+  pthread_mutex_init(&run.lock, NULL);
+  pthread_cond_init(&run.committed, NULL);
+
+  unsigned started = 0;
+  for(; pool != NULL && started < threads; started++) {
+    if(pthread_create(&pool[started], NULL, random_worker, &run) != 0) break;
+  }
+  if(started == 0) random_worker(&run);
+  for(unsigned i = 0; i < started; i++) {
+    pthread_join(pool[i], NULL);
+  }
+
+  pthread_cond_destroy(&run.committed);
+  pthread_mutex_destroy(&run.lock);
+  free(pool);
+  return run.failed ? 1 : 0;
+}
+
+// Write out count pokémon (or all the rest, if count is 0) of the archive at
+// path, from record first
+// returns the exit status
+static int extract_run(const char *path, uint64_t first, uint64_t count,
+                       struct Output *output) {
+  static struct Pokemon out[BATCH_RECORDS];
+  struct Archive archive;
+  int status = 0;
+
+  if(!pokegen_archive_open(&archive, path)) return !library_error();
+  if(first > archive.records) first = archive.records;
+  if(count == 0 || count > archive.records - first) count = archive.records - first;
+
+  for(uint64_t done = 0; done < count;) {
+    size_t n = count - done < BATCH_RECORDS ? (size_t) (count - done) : BATCH_RECORDS;
+
+    pokegen_archive_records(&archive, first + done, n, out);
+    if(!batch_flush(output, out, n, done, true)) {
+      status = 1;
+      break;
+    }
+    done += n;
+  }
+
+  pokegen_archive_close(&archive);
+  return status;
+}
+
+/* Generation server
+ * Serves pokémon over a Unix socket to clients sending binary requests:
+ *   request:  u32 length, then fields of u16 option, u8 length, argument
+ *   response: u32 length, u8 status (0 if built), then the 100 byte pokémon
+ * Options are the val of a long option (or FIELD_NICKNAME/FIELD_TRAINER_NAME)
+ * and integers are little endian. The event loop thread parses requests, and
+ * workers take every request queued so far as one batch to build and encrypt. */
+#define FIELD_NICKNAME 0x300
+#define FIELD_TRAINER_NAME 0x301
+#define FIELDS 0x302
+#define REQUEST_MAX 4096
+#define RESPONSE_HEADER 5
+#define SERVE_EVENTS 64
+#define SERVE_REPORT_SECONDS 10
+#define LATENCY_SAMPLES 65536
+
+struct ServeConn {
+  int fd;
+  struct ServeConn *next_dead;
+  bool closed; // the client has gone; freed once no jobs are pending
+  bool eof; // the client has finished sending; closed once everything is answered
+  uint32_t events; // what epoll is waiting for
+  size_t pending; // jobs not yet answered
+  size_t rlen;
+  uint8_t rbuf[REQUEST_MAX + 4];
+  uint8_t *wbuf;
+  size_t wlen, wcap;
+};
+
+struct ServeJob {
+  struct ServeConn *conn;
+  struct Spec spec;
+  struct Pokemon pkmn;
+  bool valid; // the request parsed
+  bool built;
+  struct timespec start;
+  struct ServeJob *next;
+};
+
+struct ServeQueue {
+  pthread_mutex_t lock;
+  pthread_cond_t ready;
+  struct ServeJob *head, **tail;
+};
+
+struct Server {
+  const struct Spec *base;
+  bool fields[FIELDS]; // options a request may set
+  struct ServeQueue todo, done;
+  int epoll, wake; // wake is an eventfd, signalled as jobs are done
+  bool stop;
+  uint64_t seed;
+  struct ServeConn *dead; // closed connections to free after this round of events
+  uint32_t latency[LATENCY_SAMPLES]; // microseconds, since the last report
+  size_t sampled; // answered since the last report; the latest are kept
+  unsigned long requests;
+};
+
+static void queue_push(struct ServeQueue *q, struct ServeJob *head, struct ServeJob **tail) {
+  pthread_mutex_lock(&q->lock);
+  *q->tail = head;
+  q->tail = tail;
+  pthread_cond_signal(&q->ready);
+  pthread_mutex_unlock(&q->lock);
+}
+
+static uint64_t elapsed_us(const struct timespec *start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t) (now.tv_sec - start->tv_sec) * 1000000 +
+         (uint64_t) ((now.tv_nsec - start->tv_nsec) / 1000);
+}
+
+// Worker thread; builds batches of queued jobs until the server stops
+static void *serve_worker(void *arg) {
+  struct Server *server = (struct Server *) arg;
+  struct Pokemon batch[BATCH_RECORDS];
+  struct ServeJob *jobs[BATCH_RECORDS];
+  uint64_t rng = server->seed ^ (uint64_t) pthread_self();
+
+  for(;;) {
+    size_t n = 0;
+
+    pthread_mutex_lock(&server->todo.lock);
+    while(server->todo.head == NULL && !server->stop) {
+      pthread_cond_wait(&server->todo.ready, &server->todo.lock);
+    }
+    if(server->stop) {
+      pthread_mutex_unlock(&server->todo.lock);
+      return NULL;
+    }
+    while(server->todo.head != NULL && n < BATCH_RECORDS) {
+      jobs[n++] = server->todo.head;
+      server->todo.head = server->todo.head->next;
+    }
+    if(server->todo.head == NULL) server->todo.tail = &server->todo.head;
+    pthread_mutex_unlock(&server->todo.lock);
+
+    // build everything, then encrypt the batch in one go
+    size_t built = 0;
+    for(size_t i = 0; i < n; i++) {
+      jobs[i]->built = jobs[i]->valid && pokegen_build(&jobs[i]->spec, &rng, &batch[built]);
+      if(jobs[i]->built) built++;
+    }
+    pokegen_encode(batch, built);
+
+    built = 0;
+    for(size_t i = 0; i < n; i++) {
+      if(jobs[i]->built) jobs[i]->pkmn = batch[built++];
+      jobs[i]->next = i + 1 < n ? jobs[i + 1] : NULL;
+    }
+
+    uint64_t one = 1;
+    queue_push(&server->done, jobs[0], &jobs[n - 1]->next);
+    if(write(server->wake, &one, sizeof(one)) < 0) perror("eventfd");
+  }
+}
+
+// Free a closed connection once no jobs are pending and its events are handled
+static void serve_conn_release(struct Server *server, struct ServeConn *conn) {
+  if(!conn->closed || conn->pending != 0) return;
+  conn->next_dead = server->dead;
+  server->dead = conn;
+}
+
+static void serve_conn_close(struct Server *server, struct ServeConn *conn) {
+  epoll_ctl(server->epoll, EPOLL_CTL_DEL, conn->fd, NULL);
+  close(conn->fd);
+  conn->closed = true;
+  serve_conn_release(server, conn);
+}
+
+// Wait for a connection to become readable, unless the client has finished
+// sending, and writable while there are responses to write
+static void serve_conn_watch(struct Server *server, struct ServeConn *conn) {
+  uint32_t events = (conn->eof ? 0 : EPOLLIN) | (conn->wlen != 0 ? EPOLLOUT : 0);
+  if(events == conn->events) return;
+
+  struct epoll_event ev = {.events = events, .data.ptr = conn};
+  epoll_ctl(server->epoll, EPOLL_CTL_MOD, conn->fd, &ev);
+  conn->events = events;
+}
+
+// Write out as much of a connection's responses as the socket takes
+static void serve_conn_flush(struct Server *server, struct ServeConn *conn) {
+  size_t done = 0;
+
+  while(done < conn->wlen) {
+    ssize_t n = write(conn->fd, conn->wbuf + done, conn->wlen - done);
+    if(n < 0 && errno == EINTR) continue;
+    if(n < 0 && errno != EAGAIN) {
+      serve_conn_close(server, conn);
+      return;
+    }
+    if(n < 0) break;
+    done += (size_t) n;
+  }
+
+  conn->wlen -= done;
+  memmove(conn->wbuf, conn->wbuf + done, conn->wlen);
+
+  // a client that has finished sending is closed once it has every answer
+  if(conn->eof && conn->pending == 0 && conn->wlen == 0) {
+    serve_conn_close(server, conn);
+    return;
+  }
+  serve_conn_watch(server, conn);
+}
+
+// Parse one request into a job, on top of the server's base spec
+// returns false (after complaining) if the request is invalid
+static bool serve_parse(struct Server *server, struct ServeJob *job,
+                        const uint8_t *req, size_t len) {
+  char arg[256];
+
+  job->spec = *server->base;
+  for(size_t i = 0; i < len;) {
+    if(len - i < 3 || len - i - 3 < req[i + 2]) {
+      fputs("request field is truncated\n", stderr);
+      return false;
+    }
+
+    int val = req[i] | (req[i + 1] << 8);
+    size_t arglen = req[i + 2];
+    memcpy(arg, req + i + 3, arglen);
+    arg[arglen] = '\0';
+    i += 3 + arglen;
+
+    if(val == FIELD_NICKNAME || val == FIELD_TRAINER_NAME) {
+      char *name = val == FIELD_NICKNAME ? job->spec.nickname : job->spec.trainer_name;
+      size_t size = val == FIELD_NICKNAME ? sizeof(job->spec.nickname) :
+                                            sizeof(job->spec.trainer_name);
+      if(arglen >= size) {
+        fprintf(stderr, "request name is longer than %zu bytes\n", size - 1);
+        return false;
+      }
+      memcpy(name, arg, arglen + 1);
+    } else if(val >= FIELDS || !server->fields[val]) {
+      fprintf(stderr, "request field 0x%x isn't a pokémon field\n", val);
+      return false;
+    } else if(!pokegen_spec_set(&job->spec, val, arg)) {
+      fprintf(stderr, "request field 0x%x: %s\n", val, pokegen_error());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Queue a job for every complete request a connection has sent
+// returns false if the connection should be closed
+static bool serve_conn_read(struct Server *server, struct ServeConn *conn) {
+  struct ServeJob *head = NULL, **tail = &head;
+
+  for(;;) {
+    ssize_t got = read(conn->fd, conn->rbuf + conn->rlen, sizeof(conn->rbuf) - conn->rlen);
+    if(got < 0 && errno == EINTR) continue;
+    if(got < 0 && errno == EAGAIN) break;
+    if(got == 0) {
+      // answer what was sent before the client finished
+      conn->eof = true;
+      break;
+    }
+    if(got < 0) goto fail;
+    conn->rlen += (size_t) got;
+
+    size_t used = 0;
+    while(conn->rlen - used >= 4) {
+      const uint8_t *p = conn->rbuf + used;
+      size_t len = p[0] | (p[1] << 8) | ((size_t) p[2] << 16) | ((size_t) p[3] << 24);
+      if(len > REQUEST_MAX) {
+        fputs("request is too long\n", stderr);
+        goto fail;
+      }
+      if(conn->rlen - used - 4 < len) break;
+
+      struct ServeJob *job = malloc(sizeof(*job));
+      if(job == NULL) {
+        perror("serve");
+        goto fail;
+      }
+      clock_gettime(CLOCK_MONOTONIC, &job->start);
+      job->conn = conn;
+      job->valid = serve_parse(server, job, p + 4, len);
+      job->next = NULL;
+      *tail = job;
+      tail = &job->next;
+      conn->pending++;
+      used += 4 + len;
+    }
+
+    conn->rlen -= used;
+    memmove(conn->rbuf, conn->rbuf + used, conn->rlen);
+  }
+
+  if(head != NULL) queue_push(&server->todo, head, tail);
+  if(conn->eof) serve_conn_flush(server, conn);
+  return true;
+
+fail:
+  // the jobs parsed so far were never queued, so won't be answered
+  while(head != NULL) {
+    struct ServeJob *next = head->next;
+    free(head);
+    conn->pending--;
+    head = next;
+  }
+  return false;
+}
+
+// Append the response to a finished job to its connection
+// returns false if it couldn't be
+static bool serve_respond(struct ServeConn *conn, const struct ServeJob *job) {
+  size_t len = RESPONSE_HEADER + (job->built ? sizeof(struct Pokemon) : 0);
+
+  if(conn->wcap - conn->wlen < len) {
+    size_t cap = conn->wcap != 0 ? conn->wcap : 4096;
+    while(cap - conn->wlen < len) cap *= 2;
+    uint8_t *grown = realloc(conn->wbuf, cap);
+    if(grown == NULL) return false;
+    conn->wbuf = grown;
+    conn->wcap = cap;
+  }
+
+  uint8_t *p = conn->wbuf + conn->wlen;
+  uint32_t body = (uint32_t) len - 4;
+  p[0] = (uint8_t) body;
+  p[1] = (uint8_t) (body >> 8);
+  p[2] = (uint8_t) (body >> 16);
+  p[3] = (uint8_t) (body >> 24);
+  p[4] = job->built ? 0 : 1;
+  if(job->built) memcpy(p + RESPONSE_HEADER, &job->pkmn, sizeof(struct Pokemon));
+  conn->wlen += len;
+  return true;
+}
+
+static int latency_cmp(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+  return (x > y) - (x < y);
+}
+
+// Report the latency of requests answered since the last report
+static void serve_report(struct Server *server) {
+  size_t samples = server->sampled < LATENCY_SAMPLES ? server->sampled : LATENCY_SAMPLES;
+  if(samples == 0) return;
+
+  qsort(server->latency, samples, sizeof(*server->latency), latency_cmp);
+  fprintf(stderr, "requests=%lu p50=%uus p99=%uus\n", server->requests,
+          server->latency[samples / 2], server->latency[(samples * 99) / 100]);
+  server->sampled = 0;
+}
+
+// Answer every job the workers have finished
+static void serve_answer(struct Server *server) {
+  uint64_t count;
+  if(read(server->wake, &count, sizeof(count)) < 0 && errno != EAGAIN) perror("eventfd");
+
+  pthread_mutex_lock(&server->done.lock);
+  struct ServeJob *job = server->done.head;
+  server->done.head = NULL;
+  server->done.tail = &server->done.head;
+  pthread_mutex_unlock(&server->done.lock);
+
+  while(job != NULL) {
+    struct ServeJob *next = job->next;
+    struct ServeConn *conn = job->conn;
+
+    conn->pending--;
+    if(conn->closed) {
+      serve_conn_release(server, conn);
+    } else if(!serve_respond(conn, job)) {
+      serve_conn_close(server, conn);
+    } else {
+      // flush once this connection's last answer in the batch is in
+      if(next == NULL || next->conn != conn) serve_conn_flush(server, conn);
+    }
+
+    // keep the latest samples once there are too many
+    uint64_t us = elapsed_us(&job->start);
+    server->latency[server->sampled++ % LATENCY_SAMPLES] = us > UINT32_MAX ? UINT32_MAX : (uint32_t) us;
+    server->requests++;
+    free(job);
+    job = next;
+  }
+}
+
+// Listen on a Unix socket at path, answering requests built on top of base
+// with threads workers, until interrupted
+// returns the exit status
+static int serve_run(const struct Spec *base, const char *path, unsigned threads,
+                     uint64_t seed) {
+  static struct Server server;
+  struct sockaddr_un addr = {.sun_family = AF_UNIX};
+  struct stat st;
+  pthread_t workers[64];
+  sigset_t signals;
+  int listener, sigfd;
+
+  if(strlen(path) >= sizeof(addr.sun_path)) {
+    fputs("socket path is too long\n", stderr);
+    return 1;
+  }
+  strcpy(addr.sun_path, path);
+  if(threads > sizeof(workers) / sizeof(*workers)) threads = sizeof(workers) / sizeof(*workers);
+
+  server.base = base;
+  server.seed = seed;
+  for(size_t i = 0; long_options[i].name != NULL; i++) {
+    if(is_spec_option(long_options[i].val)) server.fields[long_options[i].val] = true;
+  }
+  pthread_mutex_init(&server.todo.lock, NULL);
+  pthread_cond_init(&server.todo.ready, NULL);
+  server.todo.tail = &server.todo.head;
+  pthread_mutex_init(&server.done.lock, NULL);
+  pthread_cond_init(&server.done.ready, NULL);
+  server.done.tail = &server.done.head;
+
+  // replace a stale socket, but nothing else
+  if(stat(path, &st) == 0 && S_ISSOCK(st.st_mode)) unlink(path);
+  if((listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) < 0 ||
+     bind(listener, (struct sockaddr *) &addr, sizeof(addr)) < 0 ||
+     listen(listener, SOMAXCONN) < 0) {
+    perror(path);
+    return 1;
+  }
+
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  sigaddset(&signals, SIGPIPE);
+  pthread_sigmask(SIG_BLOCK, &signals, NULL);
+  sigdelset(&signals, SIGPIPE);
+
+  server.epoll = epoll_create1(EPOLL_CLOEXEC);
+  server.wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  sigfd = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+  if(server.epoll < 0 || server.wake < 0 || sigfd < 0) {
+    perror("serve");
+    return 1;
+  }
+
+  struct epoll_event ev = {.events = EPOLLIN, .data.ptr = &listener};
+  epoll_ctl(server.epoll, EPOLL_CTL_ADD, listener, &ev);
+  ev.data.ptr = &server.wake;
+  epoll_ctl(server.epoll, EPOLL_CTL_ADD, server.wake, &ev);
+  ev.data.ptr = &sigfd;
+  epoll_ctl(server.epoll, EPOLL_CTL_ADD, sigfd, &ev);
+
+  unsigned started = 0;
+  for(; started < threads; started++) {
+    if(pthread_create(&workers[started], NULL, serve_worker, &server) != 0) break;
+  }
+  if(started == 0) {
+    fputs("serve: couldn't start any workers\n", stderr);
+    close(listener);
+    unlink(path);
+    return 1;
+  }
+
+  time_t last_report = time(NULL);
+  bool running = true;
+  while(running) {
+    struct epoll_event events[SERVE_EVENTS];
+    int n = epoll_wait(server.epoll, events, SERVE_EVENTS, 1000);
+
+    for(int i = 0; i < n; i++) {
+      void *ptr = events[i].data.ptr;
+
+      if(ptr == &listener) {
+        int fd;
+        while((fd = accept4(listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+          struct ServeConn *conn = calloc(1, sizeof(*conn));
+          if(conn == NULL) {
+            close(fd);
+            continue;
+          }
+          conn->fd = fd;
+          conn->events = EPOLLIN;
+          struct epoll_event cev = {.events = EPOLLIN, .data.ptr = conn};
+          epoll_ctl(server.epoll, EPOLL_CTL_ADD, fd, &cev);
+        }
+      } else if(ptr == &server.wake) {
+        serve_answer(&server);
+      } else if(ptr == &sigfd) {
+        running = false;
+      } else {
+        struct ServeConn *conn = (struct ServeConn *) ptr;
+        if(!conn->closed && (events[i].events & EPOLLOUT)) serve_conn_flush(&server, conn);
+        if(!conn->closed && conn->eof && (events[i].events & (EPOLLERR | EPOLLHUP))) {
+          serve_conn_close(&server, conn);
+        } else if(!conn->closed && !conn->eof &&
+                  (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) &&
+                  !serve_conn_read(&server, conn)) {
+          serve_conn_close(&server, conn);
+        }
+      }
+    }
+
+    while(server.dead != NULL) {
+      struct ServeConn *conn = server.dead;
+      server.dead = conn->next_dead;
+      free(conn->wbuf);
+      free(conn);
+    }
+
+    if(time(NULL) - last_report >= SERVE_REPORT_SECONDS) {
+      serve_report(&server);
+      last_report = time(NULL);
+    }
+  }
 
-struct Attacks {
-  uint16_t moves[4];
-  uint8_t pp[4];
-};
+  pthread_mutex_lock(&server.todo.lock);
+  server.stop = true;
+  pthread_cond_broadcast(&server.todo.ready);
+  pthread_mutex_unlock(&server.todo.lock);
+  for(unsigned i = 0; i < started; i++) pthread_join(workers[i], NULL);
 
-struct Condition {
-  uint8_t hp_ev;
-  uint8_t attack_ev;
-  uint8_t defense_ev;
-  uint8_t speed_ev;
-  uint8_t special_attack_ev;
-  uint8_t special_defense_ev;
-  uint8_t coolness;
-  uint8_t beauty;
-  uint8_t cuteness;
-  uint8_t smartness;
-  uint8_t toughness;
-  uint8_t feel;
-};
+  serve_report(&server);
+  close(listener);
+  unlink(path);
+  return 0;
+}
 
-struct Pokerus {
-  uint8_t days_remaining:4;
-  uint8_t strain:4;
-};
 
-#define GAME_COLOSSEUM_BONUS 0
-#define GAME_SAPPHIRE 1
-#define GAME_RUBY 2
-#define GAME_EMERALD 3
-#define GAME_FIRERED 4
-#define GAME_LEAFGREEN 5
-#define GAME_COLOSSEUM_XD 15
-
-#define POKEBALL_MASTER 1
-#define POKEBALL_ULTRA 2
-#define POKEBALL_GREAT 3
-#define POKEBALL_STANDARD 4
-#define POKEBALL_SAFARI 5
-#define POKEBALL_DIVE 7
-#define POKEBALL_NEST 8
-#define POKEBALL_REPEAT 9
-#define POKEBALL_TIMER 10
-#define POKEBALL_LUXURY 11
-#define POKEBALL_PREMIER 12
-
-#define TRAINER_MALE 0
-#define TRAINER_FEMALE 1
-
-struct Origins {
-  uint16_t level_met:7;
-  uint16_t game_met:4;
-  uint16_t pokeball_type:4;
-  uint16_t trainer_gender:1;
-};
+/* Emulator stand-in
+ * Maps fake EWRAM and IWRAM at their GBA addresses, so injection can be tried
+ * out (and tested) without an emulator. */
+#define EWRAM_ADDRESS 0x02000000UL
+#define EWRAM_SIZE 0x40000UL
+#define IWRAM_ADDRESS 0x03000000UL
+#define IWRAM_SIZE 0x8000UL
 
-#define ABILITY_PRIMARY 0
-#define ABILITY_SECONDARY 1
-
-struct IVs {
-  uint32_t hp:5;
-  uint32_t attack:5;
-  uint32_t defense:5;
-  uint32_t speed:5;
-  uint32_t special_attack:5;
-  uint32_t special_defense:5;
-  uint32_t egg:1;
-  uint32_t ability:1;
-};
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+// Output our pid, wait for stdin to close, then output the count pokémon at
+// the output address
+// returns the exit status
+static int stand_in_run(struct Output *output, size_t count) {
+  static const unsigned long regions[][2] = {
+    {EWRAM_ADDRESS, EWRAM_SIZE},
+    {IWRAM_ADDRESS, IWRAM_SIZE}
+  };
+  unsigned long end = output->address + (count * sizeof(struct Pokemon));
+  bool inside = false;
+  char buf[256];
+
+  for(size_t i = 0; i < sizeof(regions) / sizeof(*regions); i++) {
+    void *want = (void *) regions[i][0];
+    void *got = mmap(want, regions[i][1], PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if(got != want) {
+      fprintf(stderr, "can't map fake memory at 0x%08lx\n", regions[i][0]);
+      return 1;
+    }
+    inside |= output->address >= regions[i][0] && end <= regions[i][0] + regions[i][1];
+  }
+  if(!inside) {
+    fputs("the pokémon to output aren't all in EWRAM or IWRAM\n", stderr);
+    return 1;
+  }
 
-struct Ribbons {
-  uint32_t cool:3;
-  uint32_t beauty:3;
-  uint32_t cute:3;
-  uint32_t smart:3;
-  uint32_t tough:3;
-  uint32_t champion:1;
-  uint32_t winning:1;
-  uint32_t victory:1;
-  uint32_t artist:1;
-  uint32_t effort:1;
-  uint32_t special1:1;
-  uint32_t special2:1;
-  uint32_t special3:1;
-  uint32_t special4:1;
-  uint32_t special5:1;
-  uint32_t special6:1;
-  uint32_t padding:5;
-  uint32_t obedience:1;
+  sprintf(buf, "%ld\n", (long) getpid());
+  outbuf_puts(output->out, buf);
+  if(!outbuf_flush(output->out)) return 1;
+
+  while(read(STDIN_FILENO, buf, sizeof(buf)) > 0);
+  return output_write(output, (const struct Pokemon *) output->address, count, 0) ? 0 : 1;
+}
+
+
+/* Decoding */
+#define DECODE_RECORDS 256
+
+static const char *const game_names[16] = {
+  [GAME_COLOSSEUM_BONUS] = "colosseum-bonus",
+  [GAME_SAPPHIRE] = "sapphire",
+  [GAME_RUBY] = "ruby",
+  [GAME_EMERALD] = "emerald",
+  [GAME_FIRERED] = "firered",
+  [GAME_LEAFGREEN] = "leafgreen",
+  [GAME_COLOSSEUM_XD] = "colosseum-xd"
 };
 
-struct Misc {
-  struct Pokerus pokerus;
-  uint8_t met_location;
-  struct Origins origins;
-  struct IVs ivs;
-  struct Ribbons ribbons;
+static const char *const pokeball_names[16] = {
+  [POKEBALL_MASTER] = "master",
+  [POKEBALL_ULTRA] = "ultra",
+  [POKEBALL_GREAT] = "great",
+  [POKEBALL_STANDARD] = "standard",
+  [POKEBALL_SAFARI] = "safari",
+  [POKEBALL_DIVE] = "dive",
+  [POKEBALL_NEST] = "nest",
+  [POKEBALL_REPEAT] = "repeat",
+  [POKEBALL_TIMER] = "timer",
+  [POKEBALL_LUXURY] = "luxury",
+  [POKEBALL_PREMIER] = "premier"
 };
 
-/* Pokémon struct and associated constants */
-#define NICKNAME_LENGTH (10)
-#define TRAINER_NAME_LENGTH (7)
-#define DATA_LENGTH (48)
-#define DATUM_LENGTH (12)
-#define DATUM_PER_DATA (DATA_LENGTH / DATUM_LENGTH)
-
-#define LANGUAGE_JAPANESE 0x0201
-#define LANGUAGE_ENGLISH 0x0202
-#define LANGUAGE_FRENCH 0x0203
-#define LANGUAGE_ITALIAN 0x0204
-#define LANGUAGE_GERMAN 0x0205
-#define LANGUAGE_KOREAN 0x0206
-#define LANGUAGE_SPANISH 0x0207
-#define LANGUAGE_EGG 0x0601
-
-#define MARKING_BULLET 0
-#define MARKING_SQUARE 1
-#define MARKING_TRIANGLE 2
-#define MARKING_HEART 3
-
-struct Status {
-  uint32_t sleep:3;
-  uint32_t poisoned:1;
-  uint32_t burnt:1;
-  uint32_t frozen:1;
-  uint32_t paralyzed:1;
-  uint32_t bad_poisoned:1;
+// Names of the problems pokegen_check() finds, by bit
+static const char *const illegal_names[ILLEGAL_KINDS] = {
+  "species", "item", "level", "moves", "pp", "evs",
+  "ability", "game", "location", "ball", "met-level", "egg"
 };
 
-struct Pokemon {
-  uint32_t personality;
-  uint32_t trainer_id;
-  char nickname[NICKNAME_LENGTH];
-  uint16_t language;
-  char trainer_name[TRAINER_NAME_LENGTH];
-  uint8_t markings;
-  uint16_t checksum;
-  uint16_t unknown;
-  uint8_t data[DATA_LENGTH];
-  struct Status status;
-  uint8_t level;
-  uint8_t pokerus;
-  uint16_t current_health;
-  uint16_t max_health;
-  uint16_t attack;
-  uint16_t defense;
-  uint16_t speed;
-  uint16_t special_attack;
-  uint16_t special_defense;
+// Name of language, or NULL if it isn't one of LANGUAGE_*
+static const char *language_name(uint16_t language) {
+  switch(language) {
+  case LANGUAGE_JAPANESE: return "ja";
+  case LANGUAGE_ENGLISH: return "en";
+  case LANGUAGE_FRENCH: return "fr";
+  case LANGUAGE_ITALIAN: return "it";
+  case LANGUAGE_GERMAN: return "de";
+  case LANGUAGE_KOREAN: return "ko";
+  case LANGUAGE_SPANISH: return "es";
+  case LANGUAGE_EGG: return "egg";
+  default: return NULL;
+  }
+}
+
+/* Decoded field output, either as a line of key=value pairs or JSON */
+struct Printer {
+  struct Outbuf *out;
+  bool json;
+  bool first;
 };
 
-void hexdump(void *addr, size_t len, size_t offset);
-bool pcsconv(char *text, size_t len, uint16_t language);
-uint16_t data_encrypt_to(
-  void *dest,
-  uint32_t personality,
-  uint32_t trainer_id,
-  struct Growth growth,
-  struct Attacks attacks,
-  struct Condition condition,
-  struct Misc misc
-);
-
-// Encrypt the pokémon structures together
-uint16_t data_encrypt_to(
-  void *dest,
-  uint32_t personality,
-  uint32_t trainer_id,
-  struct Growth growth,
-  struct Attacks attacks,
-  struct Condition condition,
-  struct Misc misc
-) {
-  uint8_t buf[DATA_LENGTH];
-  void *datum[DATUM_PER_DATA];
-  uint32_t order = personality % 24;
-
-  // Find data ordering
-  switch(order) {
-  case 0:
-  case 1:
-  case 2:
-  case 3:
-  case 4:
-  case 5:
-    datum[0] = &growth;
-    break;
-  case 6:
-  case 7:
-  case 8:
-  case 9:
-  case 10:
-  case 11:
-    datum[0] = &attacks;
-    break;
-  case 12:
-  case 13:
-  case 14:
-  case 15:
-  case 16:
-  case 17:
-    datum[0] = &condition;
-    break;
-  case 18:
-  case 19:
-  case 20:
-  case 21:
-  case 22:
-  case 23:
-    datum[0] = &misc;
-    break;
-  default: abort();
-  };
+static void print_key(struct Printer *p, const char *key) {
+  if(p->json) {
+    outbuf_puts(p->out, p->first ? "{\"" : ",\"");
+    outbuf_puts(p->out, key);
+    outbuf_puts(p->out, "\":");
+  } else {
+    if(!p->first) outbuf_putc(p->out, ' ');
+    outbuf_puts(p->out, key);
+    outbuf_putc(p->out, '=');
+  }
+  p->first = false;
+}
 
-  switch(order) {
-  case 0:
-  case 1:
-  case 14:
-  case 15:
-  case 20:
-  case 21:
-    datum[1] = &attacks;
-    break;
-  case 2:
-  case 3:
-  case 8:
-  case 9:
-  case 22:
-  case 23:
-    datum[1] = &condition;
-    break;
-  case 4:
-  case 5:
-  case 10:
-  case 11:
-  case 16:
-  case 17:
-    datum[1] = &misc;
-    break;
-  case 6:
-  case 7:
-  case 12:
-  case 13:
-  case 18:
-  case 19:
-    datum[1] = &growth;
-    break;
-  default: abort();
-  };
+static void print_uint(struct Printer *p, const char *key, unsigned long value) {
+  char buf[24], *digits = buf + sizeof(buf);
 
-  switch(order) {
-  case 0:
-  case 5:
-  case 6:
-  case 11:
-  case 19:
-  case 21:
-    datum[2] = &condition;
-    break;
-  case 1:
-  case 3:
-  case 7:
-  case 9:
-  case 13:
-  case 15:
-    datum[2] = &misc;
-    break;
-  case 2:
-  case 4:
-  case 12:
-  case 17:
-  case 18:
-  case 23:
-    datum[2] = &attacks;
-    break;
-  case 8:
-  case 10:
-  case 14:
-  case 16:
-  case 20:
-  case 22:
-    datum[2] = &growth;
-    break;
-  default: abort();
-  };
+  *--digits = '\0';
+  do {
+    *--digits = (char) ('0' + (value % 10));
+    value /= 10;
+  } while(value != 0);
 
-  switch(order) {
-  case 0:
-  case 2:
-  case 6:
-  case 8:
-  case 12:
-  case 14:
-    datum[3] = &misc;
-    break;
-  case 1:
-  case 4:
-  case 7:
-  case 10:
-  case 18:
-  case 20:
-    datum[3] = &condition;
-    break;
-  case 3:
-  case 5:
-  case 13:
-  case 16:
-  case 19:
-  case 22:
-    datum[3] = &attacks;
-    break;
-  case 9:
-  case 11:
-  case 15:
-  case 17:
-  case 21:
-  case 23:
-    datum[3] = &growth;
-    break;
-  default: abort();
-  };
+  print_key(p, key);
+  outbuf_puts(p->out, digits);
+}
+
+static void print_str(struct Printer *p, const char *key, const char *value) {
+  print_key(p, key);
+  if(p->json) outbuf_putc(p->out, '"');
+  outbuf_puts(p->out, value);
+  if(p->json) outbuf_putc(p->out, '"');
+}
+
+static void print_bytes(struct Printer *p, const char *key, const void *addr, size_t len) {
+  char buf[2 * 32 + 1];
+  size_t i;
+
+  for(i = 0; i < len && i < 32; i++) {
+    buf[2 * i] = hex_digits[((const uint8_t *) addr)[i] >> 4];
+    buf[(2 * i) + 1] = hex_digits[((const uint8_t *) addr)[i] & 0xf];
+  }
+  buf[2 * i] = '\0';
+  print_str(p, key, buf);
+}
+
+static void print_quad(struct Printer *p, const char *key,
+                       unsigned a, unsigned b, unsigned c, unsigned d) {
+  char buf[4 * 11 + 4];
+  sprintf(buf, "%u:%u:%u:%u", a, b, c, d);
+  print_str(p, key, buf);
+}
+
+static void print_end(struct Printer *p) {
+  outbuf_puts(p->out, p->json ? "}\n" : "\n");
+  p->first = true;
+}
+
+// Print every field of a decoded pokémon; keys follow the long options
+static void decode_print(struct Printer *p, const struct Spec *spec,
+                         size_t record, bool valid) {
+  const struct Pokemon *pkmn = &spec->pkmn;
+  const struct Growth *growth = &spec->growth;
+  const struct Attacks *attacks = &spec->attacks;
+  const struct Condition *condition = &spec->condition;
+  const struct Misc *misc = &spec->misc;
+  const char *name;
+  char buf[32];
+
+  print_uint(p, "record", record);
+  print_str(p, "checksum", valid ? "valid" : "invalid");
+  print_uint(p, "personality", pkmn->personality);
+  print_uint(p, "trainer-id", pkmn->trainer_id);
+  print_str(p, "trainer-gender",
+            misc->origins.trainer_gender == TRAINER_FEMALE ? "female" : "male");
+  if(spec->nickname[0] != '\0') print_str(p, "nickname", spec->nickname);
+  if(spec->trainer_name[0] != '\0') print_str(p, "trainer-name", spec->trainer_name);
+  print_bytes(p, "nickname-bytes", pkmn->nickname, NICKNAME_LENGTH);
+  print_bytes(p, "trainer-name-bytes", pkmn->trainer_name, TRAINER_NAME_LENGTH);
+  if((name = language_name(pkmn->language)) != NULL) {
+    print_str(p, "met-language", name);
+  } else {
+    print_uint(p, "met-language", pkmn->language);
+  }
+  print_uint(p, "markings", pkmn->markings);
+
+  print_uint(p, "species", growth->species);
+  print_uint(p, "item", growth->held_item);
+  print_uint(p, "experience", growth->experience);
+  print_quad(p, "pp-bonus", growth->pp_bonus.move1, growth->pp_bonus.move2,
+             growth->pp_bonus.move3, growth->pp_bonus.move4);
+  print_uint(p, "friendship", growth->friendship);
 
-  // Assemble data
-  for(size_t i = 0; i < DATUM_PER_DATA; i++) {
-    memcpy(buf + (DATUM_LENGTH * i), datum[i], DATUM_LENGTH);
+  print_quad(p, "moves", attacks->moves[0], attacks->moves[1],
+             attacks->moves[2], attacks->moves[3]);
+  print_quad(p, "moves-pp", attacks->pp[0], attacks->pp[1],
+             attacks->pp[2], attacks->pp[3]);
+
+  print_uint(p, "ev-hp", condition->hp_ev);
+  print_uint(p, "ev-attack", condition->attack_ev);
+  print_uint(p, "ev-defense", condition->defense_ev);
+  print_uint(p, "ev-speed", condition->speed_ev);
+  print_uint(p, "ev-special-attack", condition->special_attack_ev);
+  print_uint(p, "ev-special-defense", condition->special_defense_ev);
+  print_uint(p, "coolness", condition->coolness);
+  print_uint(p, "beauty", condition->beauty);
+  print_uint(p, "cuteness", condition->cuteness);
+  print_uint(p, "smartness", condition->smartness);
+  print_uint(p, "toughness", condition->toughness);
+  print_uint(p, "feel", condition->feel);
+
+  sprintf(buf, "%u:%u", misc->pokerus.days_remaining, misc->pokerus.strain);
+  print_str(p, "pokerus", buf);
+  print_uint(p, "met-location", misc->met_location);
+  print_uint(p, "met-level", misc->origins.level_met);
+  if((name = game_names[misc->origins.game_met]) != NULL) {
+    print_str(p, "met-game", name);
+  } else {
+    print_uint(p, "met-game", misc->origins.game_met);
+  }
+  if((name = pokeball_names[misc->origins.pokeball_type]) != NULL) {
+    print_str(p, "pokeball", name);
+  } else {
+    print_uint(p, "pokeball", misc->origins.pokeball_type);
   }
+  print_uint(p, "iv-hp", misc->ivs.hp);
+  print_uint(p, "iv-attack", misc->ivs.attack);
+  print_uint(p, "iv-defense", misc->ivs.defense);
+  print_uint(p, "iv-speed", misc->ivs.speed);
+  print_uint(p, "iv-special-attack", misc->ivs.special_attack);
+  print_uint(p, "iv-special-defense", misc->ivs.special_defense);
+  print_uint(p, "egg", misc->ivs.egg);
+  print_str(p, "ability",
+            misc->ivs.ability == ABILITY_SECONDARY ? "secondary" : "primary");
+  *put_hex(buf, misc->ribbons, 8) = '\0';
+  print_str(p, "ribbons", buf);
+
+  *put_hex(buf, pkmn->status, 8) = '\0';
+  print_str(p, "status", buf);
+  print_uint(p, "level", pkmn->level);
+  print_uint(p, "pokerus-left", pkmn->pokerus);
+  print_uint(p, "hp", pkmn->current_health);
+  print_uint(p, "max-hp", pkmn->max_health);
+  print_uint(p, "attack", pkmn->attack);
+  print_uint(p, "defense", pkmn->defense);
+  print_uint(p, "speed", pkmn->speed);
+  print_uint(p, "special-attack", pkmn->special_attack);
+  print_uint(p, "special-defense", pkmn->special_defense);
+  print_end(p);
+}
 
-  // Checksum data
-  uint16_t cksum = 0;
-  for(size_t i = 0; i < (DATA_LENGTH / sizeof(uint16_t)); i++) {
-    cksum += ((uint16_t *) buf)[i];
+// Join the names of the ILLEGAL_* kinds in kinds into buf, after prefix,
+// each preceded by a comma
+static void check_names(char *buf, const char *prefix, uint32_t kinds) {
+  strcpy(buf, prefix);
+  for(size_t i = 0; i < ILLEGAL_KINDS; i++) {
+    if(kinds & (1U << i)) {
+      strcat(buf, ",");
+      strcat(buf, illegal_names[i]);
+    }
   }
+}
+
+// Print the problems with a pokémon that fails its checksum or pokegen_check(),
+// and what pokegen_check() couldn't check
+static void check_print(struct Printer *p, size_t record, bool valid, uint32_t illegal,
+                        uint32_t unchecked) {
+  char buf[16 * (ILLEGAL_KINDS + 1)];
 
-  // Encrypt data
-  uint32_t key = personality ^ trainer_id;
-  for(size_t i = 0; i < (DATA_LENGTH / sizeof(uint32_t)); i++) {
-    ((uint32_t *) buf)[i] ^= key;
+  print_uint(p, "record", record);
+  if(!valid || illegal != 0) {
+    check_names(buf, valid ? "" : ",checksum", illegal);
+    print_str(p, "problems", buf + 1);
   }
-  memcpy(dest, buf, DATA_LENGTH);
-  return cksum;
+  if(unchecked != 0) {
+    check_names(buf, "", unchecked);
+    print_str(p, "unchecked", buf + 1);
+  }
+  print_end(p);
 }
 
-// Output block addr, of size len, as an xxd style hexdump.
-// offset is the offset of the starting bit numbers
-void hexdump(void *addr, size_t len, size_t offset) {
-  uint8_t *_addr = (uint8_t *) addr;
-  char ascii_buf[17];
-  size_t i;
+// Decode and print every pokémon in input, or with check, only the problems
+// with those that are illegal and what couldn't be checked
+// returns the exit status; 1 if any record is truncated, fails its checksum or
+// is illegal
+static int decode_run(FILE *input, struct Outbuf *out, bool json, bool check) {
+  static struct Pokemon in[DECODE_RECORDS];
+  struct Printer printer = {.out = out, .json = json, .first = true};
+  size_t have = 0, got, total = 0, invalid = 0, illegal = 0, partial = 0;
+  int status = 0;
+
+  while((got = fread((uint8_t *) in + have, 1, sizeof(in) - have, input)) > 0) {
+    have += got;
+
+    size_t n = have / sizeof(struct Pokemon);
+    for(size_t i = 0; i < n; i++) {
+      struct Spec spec;
+      bool valid = pokegen_decode(&spec, &in[i]);
 
-  for(i = 0; i < len; ++i) {
-    if((i % 16) == 0) {
-      if(i != 0) {
-        printf("  %s\n", ascii_buf);
+      if(!valid) invalid++;
+      if(!check) {
+        decode_print(&printer, &spec, total + i, valid);
+        continue;
       }
 
-      printf("%08lx:", offset + i);
+      uint32_t unchecked, problems = pokegen_check(&spec, &unchecked);
+      if(!valid || problems != 0) illegal++;
+      if(unchecked != 0) partial++;
+      if(!valid || problems != 0 || unchecked != 0) {
+        check_print(&printer, total + i, valid, problems, unchecked);
+      }
     }
+    total += n;
 
-    printf(" %02x", _addr[i]);
+    // keep any partial record for the next read
+    have -= n * sizeof(struct Pokemon);
+    memmove(in, &in[n], have);
+  }
 
-    if((_addr[i] < 0x20) || (_addr[i] > 0x7e)) {
-      ascii_buf[i % 16] = '.';
-    } else {
-      ascii_buf[i % 16] = (char) _addr[i];
+  if(!outbuf_flush(out)) {
+    status = 1;
+  } else if(ferror(input)) {
+    perror("decode");
+    status = 1;
+  } else if(have != 0) {
+    fputs("input ends with a partial record\n", stderr);
+    status = 1;
+  }
+  if(check && partial > 0) {
+    fprintf(stderr, "%zu of %zu records couldn't be checked fully\n", partial, total);
+  }
+  if(check && illegal > 0) {
+    fprintf(stderr, "%zu of %zu records are illegal\n", illegal, total);
+    status = 1;
+  } else if(invalid > 0) {
+    fprintf(stderr, "%zu of %zu records failed their checksum\n", invalid, total);
+    status = 1;
+  }
+  return status;
+}
+
+// Find and print every pokémon in the memory dump at path, searching with
+// threads threads; each line starts with the record's offset in the dump
+// returns the exit status
+static int scan_run(const char *path, struct Outbuf *out, bool json, unsigned threads) {
+  struct Printer printer = {.out = out, .json = json, .first = true};
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+
+  if(fd < 0 || fstat(fd, &st) < 0) {
+    perror(path);
+    if(fd >= 0) close(fd);
+    return 1;
+  }
+
+  size_t len = (size_t) st.st_size;
+  const uint8_t *dump = NULL;
+  if(len > 0) {
+    dump = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(dump == MAP_FAILED) {
+      perror(path);
+      close(fd);
+      return 1;
     }
-    ascii_buf[(i % 16) + 1] = '\0';
-  };
+    madvise((void *) dump, len, MADV_SEQUENTIAL);
+  }
+  close(fd);
+
+  size_t *hits, found;
+  int status = 0;
+  if(!pokegen_scan_dump(dump, len, threads, &hits, &found)) {
+    status = !library_error();
+  } else {
+    for(size_t i = 0; i < found; i++) {
+      struct Pokemon pkmn = {0};
+      struct Spec spec;
+      size_t have = len - hits[i];
 
-  for(; (i % 16) != 0; ++i) {
-    printf("   ");
+      // a box pokémon at the end of the dump has no party fields
+      memcpy(&pkmn, dump + hits[i], have < sizeof(pkmn) ? have : sizeof(pkmn));
+      bool valid = pokegen_decode(&spec, &pkmn);
+      print_uint(&printer, "offset", hits[i]);
+      decode_print(&printer, &spec, i, valid);
+    }
+    free(hits);
+    if(!outbuf_flush(out)) status = 1;
   }
 
-  printf("  %s\n", ascii_buf);
+  if(dump != NULL) munmap((void *) dump, len);
+  return status;
 }
 
-// Convert a string into the Pokémon proprietary character set
-// returns false if character in string isn't in that set
-// (or is a japanese character not included in our mapping)
-#define CCV(c, h) case (c): text[i] = (char)(h); break
-bool pcsconv(char *text, size_t len, uint16_t language) {
-  if(language != LANGUAGE_ENGLISH) return false;
+/* Record queries
+ * Workers claim whole files to query, and print their matches in the order
+ * the files were given: the worker on the earliest file not yet finished
+ * prints as it goes, and the others keep their matches until it's their turn. */
+#define QUERY_RAW 0
+#define QUERY_SAVE 1
+#define QUERY_ARCHIVE 2
 
-  for(size_t i = 0; i < len; i++) {
-    switch(text[i]) {
-    CCV(' ', 0x00);
-    CCV('&', 0x2d);
-    CCV('+', 0x2e);
-    CCV('=', 0x35);
-    CCV('%', 0x5b);
-    CCV('(', 0x5c);
-    CCV(')', 0x5d);
-    CCV('0', 0xa1);
-    CCV('1', 0xa2);
-    CCV('2', 0xa3);
-    CCV('3', 0xa4);
-    CCV('4', 0xa5);
-    CCV('5', 0xa6);
-    CCV('6', 0xa7);
-    CCV('7', 0xa8);
-    CCV('8', 0xa9);
-    CCV('9', 0xaa);
-    CCV('!', 0xab);
-    CCV('?', 0xac);
-    CCV('.', 0xad);
-    CCV('-', 0xae);
-    CCV(',', 0xb8);
-    CCV('/', 0xba);
-    CCV('A', 0xbb);
-    CCV('B', 0xbc);
-    CCV('C', 0xbd);
-    CCV('D', 0xbe);
-    CCV('E', 0xbf);
-    CCV('F', 0xc0);
-    CCV('G', 0xc1);
-    CCV('H', 0xc2);
-    CCV('I', 0xc3);
-    CCV('J', 0xc4);
-    CCV('K', 0xc5);
-    CCV('L', 0xc6);
-    CCV('M', 0xc7);
-    CCV('N', 0xc8);
-    CCV('O', 0xc9);
-    CCV('P', 0xca);
-    CCV('Q', 0xcb);
-    CCV('R', 0xcc);
-    CCV('S', 0xcd);
-    CCV('T', 0xce);
-    CCV('U', 0xcf);
-    CCV('V', 0xd0);
-    CCV('W', 0xd1);
-    CCV('X', 0xd2);
-    CCV('Y', 0xd3);
-    CCV('Z', 0xd4);
-    CCV('a', 0xd5);
-    CCV('b', 0xd6);
-    CCV('c', 0xd7);
-    CCV('d', 0xd8);
-    CCV('e', 0xd9);
-    CCV('f', 0xda);
-    CCV('g', 0xdb);
-    CCV('h', 0xdc);
-    CCV('i', 0xdd);
-    CCV('j', 0xde);
-    CCV('k', 0xdf);
-    CCV('l', 0xe0);
-    CCV('m', 0xe1);
-    CCV('n', 0xe2);
-    CCV('o', 0xe3);
-    CCV('p', 0xe4);
-    CCV('q', 0xe5);
-    CCV('r', 0xe6);
-    CCV('s', 0xe7);
-    CCV('t', 0xe8);
-    CCV('u', 0xe9);
-    CCV('v', 0xea);
-    CCV('w', 0xeb);
-    CCV('x', 0xec);
-    CCV('y', 0xed);
-    CCV('z', 0xee);
-    CCV(':', 0xf0);
-    CCV('\n', 0xfe);
-    CCV('\0', 0xff);
-    default:
-      return false;
+struct QueryRun {
+  const struct Query *query;
+  char *const *paths;
+  size_t files;
+  struct Printer *printer;
+  atomic_size_t next_file;
+  pthread_mutex_t lock;
+  pthread_cond_t committed;
+  size_t commit_file; // files are printed in order
+  bool failed;
+};
+
+// A file's matches not yet printed
+struct QueryFile {
+  const char *path;
+  unsigned kind;
+  struct Pokemon *pkmn;
+  uint64_t *record; // record number, or save slot (party 0-5, then the PC)
+  size_t n, cap;
+  uint8_t plain[QUERY_BLOCK * sizeof(struct Pokemon)];
+  uint8_t match[QUERY_BLOCK];
+  struct Pokemon in[QUERY_BLOCK];
+};
+
+// Print f's matches if it's f's turn, or if wait, once it is
+static void query_print(struct QueryRun *run, size_t file, struct QueryFile *f, bool wait) {
+  pthread_mutex_lock(&run->lock);
+  while(wait && run->commit_file != file) pthread_cond_wait(&run->committed, &run->lock);
+  bool turn = run->commit_file == file;
+  pthread_mutex_unlock(&run->lock);
+  if(!turn) return;
+
+  // only this worker prints until it moves commit_file on
+  for(size_t i = 0; i < f->n; i++) {
+    struct Spec spec;
+    char slot[32];
+    uint64_t r = f->record[i];
+    bool valid = pokegen_decode(&spec, &f->pkmn[i]);
+
+    print_str(run->printer, "file", f->path);
+    if(f->kind == QUERY_SAVE) {
+      if(r < PARTY_SIZE) {
+        sprintf(slot, "party:%u", (unsigned) r + 1);
+      } else {
+        sprintf(slot, "box:%u:%u", (unsigned) (r - PARTY_SIZE) / BOX_SIZE + 1,
+                (unsigned) (r - PARTY_SIZE) % BOX_SIZE + 1);
+      }
+      print_str(run->printer, "slot", slot);
+    }
+    decode_print(run->printer, &spec, r, valid);
+  }
+  f->n = 0;
+
+  if(wait) {
+    pthread_mutex_lock(&run->lock);
+    run->commit_file++;
+    pthread_cond_broadcast(&run->committed);
+    pthread_mutex_unlock(&run->lock);
+  }
+}
+
+// Keep those of the n pokémon in f->in, numbered from first, that match, then
+// print them if it's f's turn; f->plain must hold what the query reads of them
+// returns false (after complaining) if there's no memory for them
+static bool query_block(struct QueryRun *run, size_t file, struct QueryFile *f,
+                        const uint64_t *record, uint64_t first, size_t n) {
+  if(pokegen_query_match(run->query, f->plain, n, f->match) == 0) return true;
+
+  for(size_t i = 0; i < n; i++) {
+    if(!f->match[i]) continue;
+
+    if(f->n == f->cap) {
+      size_t cap = f->cap == 0 ? QUERY_BLOCK : f->cap * 2;
+      struct Pokemon *pkmn = realloc(f->pkmn, cap * sizeof(*pkmn));
+      if(pkmn != NULL) f->pkmn = pkmn;
+      uint64_t *r = realloc(f->record, cap * sizeof(*r));
+      if(r != NULL) f->record = r;
+      if(pkmn == NULL || r == NULL) {
+        perror(f->path);
+        return false;
+      }
+      f->cap = cap;
     }
+    f->pkmn[f->n] = f->in[i];
+    f->record[f->n++] = record != NULL ? record[i] : first + i;
   }
 
+  query_print(run, file, f, false);
   return true;
 }
-#undef CCV
 
-int main(int argc, char **argv) {
-  // Ensure structs have correct sizes
-  assert(sizeof(struct PPBonus) == 1);
-  assert(sizeof(struct Growth) == 12);
-  assert(sizeof(struct Attacks) == 12);
-  assert(sizeof(struct Condition) == 12);
-  assert(sizeof(struct Pokerus) == 1);
-  assert(sizeof(struct Origins) == 2);
-  assert(sizeof(struct IVs) == 4);
-  assert(sizeof(struct Ribbons) == 4);
-  assert(sizeof(struct Misc) == 12);
-  assert(sizeof(struct Status) == 4);
-  assert(sizeof(struct Pokemon) == 100);
-
-  // Init RNG
-  srand((unsigned int) time(NULL));
+// Query a stream of 100 byte records
+static bool query_raw(struct QueryRun *run, size_t file, struct QueryFile *f, FILE *input) {
+  uint64_t total = 0;
+  size_t have = 0, got;
 
-  // Construct Structure
-  struct Growth growth = {
-    .species = 1,
-    .held_item = 0,
-    .experience = 0,
-    .pp_bonus = (struct PPBonus) {
-      .move1 = 0,
-      .move2 = 0,
-      .move3 = 0,
-      .move4 = 0
-    },
-    .friendship = 0xff,
-    .unknown = 0,
-  };
+  while((got = fread((uint8_t *) f->in + have, 1, sizeof(f->in) - have, input)) > 0) {
+    have += got;
+    if(have < sizeof(f->in) && !feof(input) && !ferror(input)) continue;
 
-  struct Attacks attacks = {
-    .moves = {0, 0, 0, 0},
-    .pp = {0, 0, 0, 0}
-  };
+    size_t n = have / sizeof(struct Pokemon);
+    pokegen_plain(f->plain, f->in, n);
+    if(!query_block(run, file, f, NULL, total, n)) return false;
+    total += n;
 
-  struct Condition condition = {
-    .hp_ev = 0xff,
-    .attack_ev = 0xff,
-    .defense_ev = 0xff,
-    .speed_ev = 0xff,
-    .special_attack_ev = 0xff,
-    .special_defense_ev = 0xff,
-    .coolness = 0xff,
-    .beauty = 0xff,
-    .cuteness = 0xff,
-    .smartness = 0xff,
-    .toughness = 0xff,
-    .feel = 0,
-  };
+    // keep any partial record for the next read
+    have -= n * sizeof(struct Pokemon);
+    memmove(f->in, &f->in[n], have);
+  }
+
+  if(ferror(input)) {
+    perror(f->path);
+    return false;
+  } else if(have != 0) {
+    fprintf(stderr, "%s: ends with a partial record\n", f->path);
+    return false;
+  }
+  return true;
+}
+
+// Query the party and PC boxes of a save file
+static bool query_save(struct QueryRun *run, size_t file, struct QueryFile *f) {
+  struct Save save;
+  uint64_t record[QUERY_BLOCK];
+  size_t n = 0;
 
-  struct Misc misc = {
-    .pokerus = (struct Pokerus) {
-      .days_remaining = 0x0,
-      .strain = 0x0,
-    },
-    .met_location = 0xff, // Fateful Encounter
-    .origins = (struct Origins) {
-      .level_met = 1,
-      .game_met = GAME_SAPPHIRE,
-      .pokeball_type = POKEBALL_STANDARD,
-      .trainer_gender = TRAINER_MALE
-    },
-    .ivs = (struct IVs) {
-      .hp = 0x1f,
-      .attack = 0x1f,
-      .defense = 0x1f,
-      .speed = 0x1f,
-      .special_attack = 0x1f,
-      .special_defense = 0x1f,
-      .egg = 0,
-      .ability = ABILITY_PRIMARY
-    },
-    .ribbons = (struct Ribbons) {
-      .cool = 0,
-      .beauty = 0,
-      .cute = 0,
-      .smart = 0,
-      .tough = 0,
-      .champion = 0,
-      .winning = 0,
-      .victory = 0,
-      .artist = 0,
-      .effort = 0,
-      .special1 = 0,
-      .special2 = 0,
-      .special3 = 0,
-      .special4 = 0,
-      .special5 = 0,
-      .special6 = 0,
-      .padding = 0,
-      .obedience = 0
+  if(!pokegen_save_open(&save, f->path, false)) return library_error();
+
+  // a save holds fewer pokémon than a block
+  for(size_t r = 0; r < PARTY_SIZE + (BOXES * BOX_SIZE); r++) {
+    struct SaveSlot slot = {.box = r >= PARTY_SIZE, .index = r < PARTY_SIZE ? r : r - PARTY_SIZE};
+    if(pokegen_save_read(&save, slot, &f->in[n])) record[n++] = r;
+  }
+  // read only, so there's nothing to write back
+  pokegen_save_close(&save);
+
+  pokegen_plain(f->plain, f->in, n);
+  return query_block(run, file, f, record, 0, n);
+}
+
+// Query a corpus archive, reading only the columns the query needs until a
+// record matches
+static bool query_archive(struct QueryRun *run, size_t file, struct QueryFile *f) {
+  struct Archive archive;
+  bool ok = true;
+
+  if(!pokegen_archive_open(&archive, f->path)) return library_error();
+
+  for(uint64_t done = 0; ok && done < archive.records;) {
+    size_t n = archive.records - done < QUERY_BLOCK ? (size_t) (archive.records - done) : QUERY_BLOCK;
+
+    pokegen_archive_gather(&archive, done, n, run->query->columns, f->plain);
+    if(pokegen_query_match(run->query, f->plain, n, f->match) != 0) {
+      for(size_t i = 0; i < n; i++) {
+        if(f->match[i]) pokegen_archive_records(&archive, done + i, 1, &f->in[i]);
+      }
+      ok = query_block(run, file, f, NULL, done, n);
     }
-  };
+    done += n;
+  }
+
+  pokegen_archive_close(&archive);
+  return ok;
+}
+
+// Work out what kind of file path is and query it
+static bool query_file(struct QueryRun *run, size_t file, struct QueryFile *f) {
+  FILE *input = stdin;
+  struct stat st;
+  uint8_t magic[4];
+  bool ok;
+
+  f->kind = QUERY_RAW;
+  if(strcmp(f->path, "-") && (input = fopen(f->path, "rb")) == NULL) {
+    perror(f->path);
+    return false;
+  }
+
+  if(fstat(fileno(input), &st) == 0 && S_ISREG(st.st_mode)) {
+    if(pread(fileno(input), magic, sizeof(magic), 0) == sizeof(magic) &&
+       (magic[0] | (magic[1] << 8) | (magic[2] << 16) | ((uint32_t) magic[3] << 24)) ==
+       ARCHIVE_MAGIC) {
+      f->kind = QUERY_ARCHIVE;
+    } else if(st.st_size >= SAVE_SIZE && st.st_size % sizeof(struct Pokemon) != 0) {
+      f->kind = QUERY_SAVE;
+    }
+  }
+
+  if(f->kind == QUERY_ARCHIVE) {
+    ok = query_archive(run, file, f);
+  } else if(f->kind == QUERY_SAVE) {
+    ok = query_save(run, file, f);
+  } else {
+    ok = query_raw(run, file, f, input);
+  }
+
+  if(input != stdin) fclose(input);
+  return ok;
+}
+
+static void *query_worker(void *arg) {
+  struct QueryRun *run = (struct QueryRun *) arg;
+  struct QueryFile *f = malloc(sizeof(*f));
+
+  if(f == NULL) {
+    perror("query");
+    pthread_mutex_lock(&run->lock);
+    run->failed = true;
+    pthread_mutex_unlock(&run->lock);
+    return NULL;
+  }
+  f->pkmn = NULL;
+  f->record = NULL;
+  f->cap = 0;
+
+  for(;;) {
+    size_t file = atomic_fetch_add(&run->next_file, 1);
+    if(file >= run->files) break;
+
+    f->path = run->paths[file];
+    f->n = 0;
+    bool ok = query_file(run, file, f);
+
+    // a file that can't be read still prints what it matched, in turn
+    query_print(run, file, f, true);
+    if(!ok) {
+      pthread_mutex_lock(&run->lock);
+      run->failed = true;
+      pthread_mutex_unlock(&run->lock);
+    }
+  }
 
-  struct Pokemon pkmn = {
-    .personality = (unsigned int) rand(),
-    .trainer_id = (unsigned int) rand(),
-    .language = 0x0202,
-    .markings = MARKING_BULLET,
-    .unknown = 0,
-    .status = (struct Status) {
-      .sleep = 0,
-      .poisoned = 0,
-      .burnt = 0,
-      .frozen = 0,
-      .paralyzed = 0,
-      .bad_poisoned = 0
-    },
-    .level = 1,
-    .pokerus = 0,
-    .current_health = 0xff,
-    .max_health = 0xff,
-    .attack = 0xff,
-    .defense = 0xff,
-    .speed = 0xff,
-    .special_attack = 0xff,
-    .special_defense = 0xff
+  free(f->pkmn);
+  free(f->record);
+  free(f);
+  return NULL;
+}
+
+// Print every pokémon in the files matching query, with threads threads
+// returns the exit status; 1 if any file couldn't be queried
+static int query_run(const struct Query *query, char *const *paths, size_t files,
+                     struct Outbuf *out, bool json, unsigned threads) {
+  static char *const input[] = {"-"};
+  struct Printer printer = {.out = out, .json = json, .first = true};
+  struct QueryRun run = {
+    .query = query,
+    .paths = files > 0 ? paths : input,
+    .files = files > 0 ? files : 1,
+    .printer = &printer,
+    .commit_file = 0,
+    .failed = false
   };
+  if(threads > run.files) threads = (unsigned) run.files;
+  pthread_t *pool = calloc(threads, sizeof(pthread_t));
 
-  // Parse Options
-  static const char optstring[] = 
-    "12a:A:b:B:c:C:d:D:e:E:f:F:gG:hH:i:I:j:k:K:l:L:"
-    "m:M:n:N:oOp:P:q:Q:r:R:s:S:t:T:u:U:v:V:x:y:Y:";
-  const char usage[] = 
-    "Usage: %s [options] <pokémon name> <trainer name>\n"
-    "\n"
-    "\t-s, --species <index>    The index number of the pokémon's species.\n"
-    "\t                         The default is 1 [Bulbasaur].\n"
-    "\t-i, --item <index>       The index number of the item to be held.\n"
-    "\t                         The default is 0 [Nothing].\n"
-    "\t-x, --experience <int>   The amount of experience that the pokémon shall have.\n"
-    "\t                         The default is 0.\n"
-    "\t-B, --pp-bonus <a>:<b>:<c>:<d>   A set of values from 1-3 of how many\n"
-    "\t                                 PP-Bonuses shall have been applied to\n"
-    "\t                                 each move slot. Each defaults to 0.\n"
-    "\t-f, --friendship <int>   The friendship of the generated pokémon.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-m, --moves <a>:<b>:<c>:<d>  The index numbers of the moves the pokémon shall have.\n"
-    "\t-P, --moves-pp <a>:<b>:<c>:<d>   The current PP of each move slot.\n"
-    "\t-j, --ev-hp <int>        The pokémon's HP effort value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-v, --ev-attack <int>    The pokémon's attack effort value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-e, --ev-defense <int>   The pokémon's defense effort value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-V, --ev-speed <int>     The pokémon's speed effort value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-K, --ev-special-attack <int>    The pokémon's special attack effort value.\n"
-    "\t                                 Must be between 0-255; the default is 255.\n"
-    "\t-E, --ev-special-defense <int>   The pokémon's HP effort value.\n"
-    "\t                                 Must be between 0-255; the default is 255.\n"
-    "\t-c, --coolness <int>   The pokémon's coolness condition.\n"
-    "\t                       Must be between 0-255; the default is 255.\n"
-    "\t-y, --beauty <int>     The pokémon's beauty condition.\n"
-    "\t                       Must be between 0-255; the default is 255.\n"
-    "\t-C, --cuteness <int>   The pokémon's cuteness condition.\n"
-    "\t                       Must be between 0-255; the default is 255.\n"
-    "\t-r, --smartness <int>  The pokémon's smartness condition.\n"
-    "\t                       Must be between 0-255; the default is 255.\n"
-    "\t-T, --toughness <int>  The pokémon's toughness condition.\n"
-    "\t                       Must be between 0-255; the default is 255.\n"
-    "\t-F, --feel <int>       The pokémon's feel (also known as luster).\n"
-    "\t                       Must be between 0-255; the default is 0.\n"
-    "\t-R, --pokerus <days remaining>:<strain>  Set pokérus status.\n"
-    "\t                       Both may be between 0-15; the defaults are 0.\n"
-    "\t-k, --met-location <index>   Set the index of the location the pokémon was met at.\n"
-    "\t                             The default is 255 [fateful encounter].\n"
-    "\t-M, --met-level <int>    Set the level the pokémon was met at.\n"
-    "\t                         Must be between 1-100; the default is 1.\n"
-    "\t-G, --met-game <colosseum-bonus|sapphire|ruby|emerald|firered|leafgreen|colosseum-xd>\n"
-    "\t                         Set the game the pokémon was met in.\n"
-    "\t-b, --pokeball <master|ultra|great|standard|safari|dive|nest|repeat|timer|luxury|premier>\n"
-    "\t                         Set the pokéball that the pokémon was caught in.\n"
-    "\t-H, --iv-hp <int>        The pokémon's HP initial value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-a, --iv-attack <int>    The pokémon's HP initial value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-d, --iv-defense <int>   The pokémon's HP initial value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-S, --iv-speed <int>     The pokémon's HP initial value.\n"
-    "\t                         Must be between 0-255; the default is 255.\n"
-    "\t-A, --iv-special-attack <int>    The pokémon's HP initial value.\n"
-    "\t                                 Must be between 0-255; the default is 255.\n"
-    "\t-D, --iv-special-defense <int>   The pokémon's HP initial value.\n"
-    "\t                                 Must be between 0-255; the default is 255.\n"
-    "\t-g, --egg                The pokémon will be generated as an egg.\n"
-    "\t-1, --ability-primary    The pokémon will use it's primary ability.\n"
-    "\t-2, --ability-secondary  The pokémon will use it's secondary ability.\n"
-    "\t-p, --personality <personality>  The pokémon's personality.\n"
-    "\t                                 Must be an integer between 0-4,294,967,295.\n"
-    "\t                                 The default is a random number in that range.\n"
-    "\t-t, --trainer <trainer id>:<male|female>   The pokémon's trainer's id and gender.\n"
-    "\t                                           The trainer ID must be an integer between\n"
-    "\t                                           0-4,294,967,295. The default is a random number\n"
-    "\t                                           in that range and male.\n"
-    "\t-N, --met-language <ja|en|fr|it|de|ko|es>  The language the pokémon was met in.\n"
-    "\t                                           The default is en [English].\n"
-    "\t-l, --level <int>          The pokémon's level.\n"
-    "\t                           Must be between 1-100; the default is 1.\n"
-    "\t-Y, --pokerus-left <int>   Time remaining in pokérus infection.\n"
-    "\t-L, --hp <int>             Current HP. Must be between 0-255; the default is 255.\n"
-    "\t-n, --max-hp <int>         Maximum HP. Must be between 0-255; the default is 255.\n"
-    "\t-q, --attack <int>         Attack stat. Must be between 0-255; the default is 255.\n"
-    "\t-u, --defense <int>        Defense stat. Must be between 0-255; the default is 255.\n"
-    "\t-I, --speed <int>          Speed stat. Must be between 0-255; the default is 255.\n"
-    "\t-Q, --special-attack <int>   Special Attack stat.\n"
-    "\t                             Must be between 0-255; the default is 255.\n"
-    "\t-U, --special-defense <int>  Special Defense stat.\n"
-    "\t                             Must be between 0-255; the default is 255.\n"
-    "\t-o, --raw                  Output as raw bytes.\n"
-    "\t-O, --dump                 Output as a hexdump.\n"
-    "\t-h, --help                 Display this message.\n"
-    "\n";
-  static struct option long_options[] = {
-    {"species", required_argument, NULL, 's'},
-    {"item", required_argument, NULL, 'i'},
-    {"experience", required_argument, NULL, 'x'},
-    {"pp-bonus", required_argument, NULL, 'B'},
-    {"friendship", required_argument, NULL, 'f'},
-    {"moves", required_argument, NULL, 'm'},
-    {"moves-pp", required_argument, NULL, 'P'},
-    {"ev-hp", required_argument, NULL, 'j'},
-    {"ev-attack", required_argument, NULL, 'v'},
-    {"ev-defense", required_argument, NULL, 'e'},
-    {"ev-speed", required_argument, NULL, 'V'},
-    {"ev-special-attack", required_argument, NULL, 'K'},
-    {"ev-special-defense", required_argument, NULL, 'E'},
-    {"coolness", required_argument, NULL, 'c'},
-    {"beauty", required_argument, NULL, 'y'},
-    {"cuteness", required_argument, NULL, 'C'},
-    {"smartness", required_argument, NULL, 'r'},
-    {"toughness", required_argument, NULL, 'T'},
-    {"feel", required_argument, NULL, 'F'},
-    {"pokerus", required_argument, NULL, 'R'},
-    {"met-location", required_argument, NULL, 'k'},
-    {"met-level", required_argument, NULL, 'M'},
-    {"met-game", required_argument, NULL, 'G'},
-    {"pokeball", required_argument, NULL, 'b'},
-    {"iv-hp", required_argument, NULL, 'H'},
-    {"iv-attack", required_argument, NULL, 'a'},
-    {"iv-defense", required_argument, NULL, 'd'},
-    {"iv-speed", required_argument, NULL, 'S'},
-    {"iv-special-attack", required_argument, NULL, 'A'},
-    {"iv-special-defense", required_argument, NULL, 'D'},
-    {"egg", no_argument, NULL, 'g'},
-    {"ability-primary", no_argument, NULL, '1'},
-    {"ability-secondary", no_argument, NULL, '2'},
-    {"personality", required_argument, NULL, 'p'},
-    {"trainer", required_argument, NULL, 't'},
-    {"met-language", required_argument, NULL, 'N'},
-    {"level", required_argument, NULL, 'l'},
-    {"pokerus-left", required_argument, NULL, 'Y'},
-    {"hp", required_argument, NULL, 'L'},
-    {"max-hp", required_argument, NULL, 'n'},
-    {"attack", required_argument, NULL, 'q'},
-    {"defense", required_argument, NULL, 'u'},
-    {"speed", required_argument, NULL, 'I'},
-    {"special-attack", required_argument, NULL, 'Q'},
-    {"special-defense", required_argument, NULL, 'U'},
-    {"raw", no_argument, NULL, 'o'},
-    {"dump", no_argument, NULL, 'O'},
-    {"help", no_argument, NULL, 'h'},
-    {0, 0, 0, 0}
+  atomic_init(&run.next_file, 0);
+  pthread_mutex_init(&run.lock, NULL);
+  pthread_cond_init(&run.committed, NULL);
+
+  unsigned started = 0;
+  for(; pool != NULL && started < threads; started++) {
+    if(pthread_create(&pool[started], NULL, query_worker, &run) != 0) break;
+  }
+  if(started == 0) query_worker(&run);
+  for(unsigned i = 0; i < started; i++) {
+    pthread_join(pool[i], NULL);
+  }
+
+  pthread_cond_destroy(&run.committed);
+  pthread_mutex_destroy(&run.lock);
+  free(pool);
+  if(!outbuf_flush(out)) run.failed = true;
+  return run.failed ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  // Ensure datum tables are inverses of each other
+  for(size_t order = 0; order < DATUM_ORDERS; order++) {
+    for(size_t i = 0; i < DATUM_PER_DATA; i++) {
+      assert(datum_offset[order][datum_order[order][i]] == i * DATUM_LENGTH);
+    }
+  }
+
+  // Init output
+  static struct Outbuf out = {.fd = STDOUT_FILENO, .error = false, .len = 0};
+
+  // Init RNG; processes started in the same second still differ
+  struct timespec now;
+  clock_gettime(CLOCK_REALTIME, &now);
+  uint64_t rng = ((uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec) ^
+                 ((uint64_t) getpid() << 40);
+
+  // Construct Structure
+  struct Spec spec;
+  pokegen_spec_init(&spec);
+
+  // Output defaults
+  struct Output output = {
+    .out = &out,
+    .format = FORMAT_HEXDUMP,
+    .address = DUMP_OFFSET,
+    .file = NULL,
+    .image = NULL,
+    .target = NULL,
+    .save = NULL,
+    .ring_slots = RING_SLOTS_DEFAULT,
+    .ring_policy = RING_WAIT
   };
 
+  // Parse Options
   int c;
-  bool dump = true;
+  bool batch = false, decode = false, check = false, json = false;
+  const char *batch_file = NULL, *decode_file = NULL, *save_file = NULL;
+  const char *serve_path = NULL, *scan_file = NULL, *extract_file = NULL;
+  struct SaveSlot slot = {.box = false, .index = 0};
+  bool slot_set = false, find_pid = false, find_seed = false;
+  long fill = 0, stand_in = 0;
+  unsigned long limit = 0;
+  unsigned long long random_count = 0, random_seed = 0, random_first = 0, first = 0;
+  bool random_seed_set = false;
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  struct PidQuery pid_query = {0};
+  struct Query query;
+  bool query_set = false;
   while((c = getopt_long(argc, argv, optstring, long_options, NULL)) != -1) {
     switch(c) {
-    case 's': // species; see bulbapedia:List_of_Pokémon_by_index_number_(Generation_III)
-      growth.species = (uint16_t) atoi(optarg);
-      break;
-    case 'i': // held item; see bulbapedia:List_of_items_by_index_number_(Generation_III)
-      growth.held_item = (uint16_t) atoi(optarg);
-      break;
-    case 'x': // experience
-      growth.experience = (uint32_t) atoi(optarg);
-      break;
-    case 'B': // pp bonuses
-      {
-        char *one = strtok(optarg, ":");
-        char *two = strtok(NULL, ":");
-        char *three = strtok(NULL, ":");
-        char *four = strtok(NULL, ":");
-
-        growth.pp_bonus.move1 = atoi(one);
-        growth.pp_bonus.move2 = atoi(two);
-        growth.pp_bonus.move3 = atoi(three);
-        growth.pp_bonus.move4 = atoi(four);
-      }
-      break;
-    case 'f': // friendship
-      growth.friendship = (uint8_t) atoi(optarg);
+    case 'o': // dump raw
+      output.format = FORMAT_RAW;
       break;
-    case 'm': // moves
-      {
-        char *one = strtok(optarg, ":");
-        char *two = strtok(NULL, ":");
-        char *three = strtok(NULL, ":");
-        char *four = strtok(NULL, ":");
-
-        attacks.moves[0] = (uint16_t) atoi(one);
-        attacks.moves[1] = (uint16_t) atoi(two);
-        attacks.moves[2] = (uint16_t) atoi(three);
-        attacks.moves[3] = (uint16_t) atoi(four);
-      }
+    case 'O': // hexdump
+      output.format = FORMAT_HEXDUMP;
       break;
-    case 'P': // pp for moves
-      {
-        char *one = strtok(optarg, ":");
-        char *two = strtok(NULL, ":");
-        char *three = strtok(NULL, ":");
-        char *four = strtok(NULL, ":");
-
-        attacks.pp[0] = (uint8_t) atoi(one);
-        attacks.pp[1] = (uint8_t) atoi(two);
-        attacks.pp[2] = (uint8_t) atoi(three);
-        attacks.pp[3] = (uint8_t) atoi(four);
+    case OPT_FORMAT: // other output formats
+      if(!output_format_parse(&output, optarg)) {
+        fputs("format must be one of hexdump|raw|gdb|gdb-restore:<file>|ips|bps:<source>|"
+              "ring:<name>|archive:<file>\n", stderr);
+        return 1;
       }
       break;
-    case 'j': // hp ev
-      condition.hp_ev = (uint8_t) atoi(optarg);
-      break;
-    case 'v': // attack ev
-      condition.attack_ev = (uint8_t) atoi(optarg);
-      break;
-    case 'e': // defense ev
-      condition.defense_ev = (uint8_t) atoi(optarg);
-      break;
-    case 'V': // speed ev
-      condition.speed_ev = (uint8_t) atoi(optarg);
-      break;
-    case 'K': // special attack ev
-      condition.special_attack_ev = (uint8_t) atoi(optarg);
-      break;
-    case 'E': // special defense ev
-      condition.special_defense_ev = (uint8_t) atoi(optarg);
+    case OPT_ADDRESS: // memory address of the output
+      output.address = strtoul(optarg, NULL, 0);
       break;
-    case 'c': // coolness
-      condition.coolness = (uint8_t) atoi(optarg);
-      break;
-    case 'y': // beauty
-      condition.beauty = (uint8_t) atoi(optarg);
-      break;
-    case 'C': // cuteness
-      condition.cuteness = (uint8_t) atoi(optarg);
-      break;
-    case 'r': // smartness
-      condition.smartness = (uint8_t) atoi(optarg);
-      break;
-    case 'T': // toughness
-      condition.toughness = (uint8_t) atoi(optarg);
-      break;
-    case 'F': // feel
-      condition.feel = (uint8_t) atoi(optarg);
-      break;
-    case 'R': // pokérus (days remaining:strain)
-      {
-        char *days = strtok(optarg, ":");
-        char *strain = strtok(NULL, ":");
-
-        misc.pokerus.days_remaining = atoi(days);
-        misc.pokerus.strain = atoi(strain);
+    case OPT_INJECT_PID: // write into another process's memory
+      if(!output_inject_parse(&output, optarg)) {
+        fputs("inject-pid must be <pid>[:<region base address>]\n", stderr);
+        return 1;
       }
       break;
-    case 'k': // location met at; see bulbapedia:List_of_locations_by_index_number_(Generation_III)
-      misc.met_location = (uint8_t) atoi(optarg);
+    case OPT_RING_SLOTS: // size of the shared memory ring
+      output.ring_slots = (uint32_t) strtoul(optarg, NULL, 0);
       break;
-    case 'M': // level met at
-      misc.origins.level_met = atoi(optarg);
-      break;
-    case 'G': // game met in
-      if(!strcmp(optarg, "colosseum-bonus")) {
-        misc.origins.game_met = GAME_COLOSSEUM_BONUS;
-      } else if(!strcmp(optarg, "sapphire")) {
-        misc.origins.game_met = GAME_SAPPHIRE;
-      } else if(!strcmp(optarg, "ruby")) {
-        misc.origins.game_met = GAME_RUBY;
-      } else if(!strcmp(optarg, "emerald")) {
-        misc.origins.game_met = GAME_EMERALD;
-      } else if(!strcmp(optarg, "firered")) {
-        misc.origins.game_met = GAME_FIRERED;
-      } else if(!strcmp(optarg, "leafgreen")) {
-        misc.origins.game_met = GAME_LEAFGREEN;
-      } else if(!strcmp(optarg, "colosseum-xd")) {
-        misc.origins.game_met = GAME_COLOSSEUM_XD;
+    case OPT_RING_FULL: // back-pressure policy of the ring
+      if(!strcmp(optarg, "wait")) {
+        output.ring_policy = RING_WAIT;
+      } else if(!strcmp(optarg, "drop")) {
+        output.ring_policy = RING_DROP;
       } else {
-        fputs("game must be one of colosseum-bonus|sapphire|ruby|emerald|"
-              "firered|leafgreen|colosseum-xd\n", stderr);
+        fputs("ring-full must be 'wait' or 'drop'\n", stderr);
         return 1;
       }
       break;
-    case 'b': // pokeball used
-      if(!strcmp(optarg, "master")) {
-        misc.origins.pokeball_type = POKEBALL_MASTER;
-      } else if(!strcmp(optarg, "ultra"))  {
-        misc.origins.pokeball_type = POKEBALL_ULTRA;
-      } else if(!strcmp(optarg, "great"))  {
-        misc.origins.pokeball_type = POKEBALL_GREAT;
-      } else if(!strcmp(optarg, "standard")) {
-        misc.origins.pokeball_type = POKEBALL_STANDARD;
-      } else if(!strcmp(optarg, "safari")) {
-        misc.origins.pokeball_type = POKEBALL_SAFARI;
-      } else if(!strcmp(optarg, "dive")) {
-        misc.origins.pokeball_type = POKEBALL_DIVE;
-      } else if(!strcmp(optarg, "nest")) {
-        misc.origins.pokeball_type = POKEBALL_NEST;
-      } else if(!strcmp(optarg, "repeat")) {
-        misc.origins.pokeball_type = POKEBALL_REPEAT;
-      } else if(!strcmp(optarg, "timer")) {
-        misc.origins.pokeball_type = POKEBALL_TIMER;
-      } else if(!strcmp(optarg, "luxury")) {
-        misc.origins.pokeball_type = POKEBALL_LUXURY;
-      } else if(!strcmp(optarg, "premier")) {
-        misc.origins.pokeball_type = POKEBALL_PREMIER;
-      } else {
-        fputs("pokeball must be one of master|ultra|great|standard|safari|"
-              "dive|nest|repeat|timer|luxury|premier\n", stderr);
+    case OPT_SERVE: // generation server
+      serve_path = optarg;
+      break;
+    case OPT_STAND_IN: // fake emulator to inject into
+      stand_in = atol(optarg);
+      if(stand_in < 1 || stand_in > BATCH_RECORDS) {
+        fputs("stand-in count must be between 1-256\n", stderr);
         return 1;
       }
       break;
-    case 'H': // hp iv
-      misc.ivs.hp = atoi(optarg);
+    case OPT_BATCH: // read specs from a file or stdin
+      batch = true;
+      batch_file = optarg;
       break;
-    case 'a': // attack iv
-      misc.ivs.attack = atoi(optarg);
+    case OPT_DECODE: // decode pokémon from a file or stdin
+      decode = true;
+      decode_file = optarg;
       break;
-    case 'd': // defense iv
-      misc.ivs.defense = atoi(optarg);
+    case OPT_CHECK: // check decoded pokémon for legality
+      check = true;
+      decode = true;
+      decode_file = optarg;
       break;
-    case 'S': // speed iv
-      misc.ivs.speed = atoi(optarg);
+    case OPT_SCAN: // find pokémon in a memory dump
+      scan_file = optarg;
       break;
-    case 'A': // special attack iv
-      misc.ivs.special_attack = atoi(optarg);
+    case OPT_JSON: // decode as json
+      json = true;
       break;
-    case 'D': // special defense iv
-      misc.ivs.special_defense = atoi(optarg);
+    case OPT_SAVE: // write into a save file
+      save_file = optarg;
       break;
-    case 'g': // is an egg?
-      {
-        misc.ivs.egg = 1;
-        pkmn.language = LANGUAGE_EGG;
+    case OPT_SLOT: // save file slot
+      if(!pokegen_save_slot_parse(&slot, optarg)) {
+        fputs("slot must be party:<1-6> or box:<1-14>:<1-30>\n", stderr);
+        return 1;
       }
+      slot_set = true;
       break;
-    case '1': // use primary ability (default)
-      misc.ivs.ability = ABILITY_PRIMARY;
+    case OPT_FIND_PID: // personality search
+      if(!pokegen_pid_query_parse(&pid_query, optarg)) return !library_error();
+      find_pid = true;
       break;
-    case '2': // use secondary ability
-      misc.ivs.ability = ABILITY_SECONDARY;
+    case OPT_FIND_SEED: // rng seed search
+      find_seed = true;
       break;
-    case 'p': // personality
-      pkmn.personality = (uint32_t) atoi(optarg);
+    case OPT_LIMIT: // stop after this many results
+      limit = strtoul(optarg, NULL, 0);
       break;
-    case 't': // trainer id:trainer gender
-      {
-        char *tid = strtok(optarg, ":");
-        char *gender = strtok(NULL, ":");
-
-        pkmn.trainer_id = (uint32_t) atoi(tid);
-
-        if(!strcmp(gender, "male")) {
-          misc.origins.trainer_gender = TRAINER_MALE;
-        } else if(!strcmp(gender, "female")) {
-          misc.origins.trainer_gender = TRAINER_FEMALE;
-        } else {
-          fputs("gender must be 'male' or 'female'\n", stderr);
-          return 1;
-        }
-      }
+    case OPT_THREADS: // worker threads
+      threads = atol(optarg);
       break;
-    case 'N': // language met in
-      {
-        if(misc.ivs.egg || pkmn.language == LANGUAGE_EGG) {
-          fputs("Cannot set a language for eggs. Disregarding.\n", stderr);
-        } else if(!strcmp(optarg, "ja")) {
-          pkmn.language = LANGUAGE_JAPANESE;
-        } else if(!strcmp(optarg, "en")) {
-          pkmn.language = LANGUAGE_ENGLISH;
-        } else if(!strcmp(optarg, "fr")) {
-          pkmn.language = LANGUAGE_FRENCH;
-        } else if(!strcmp(optarg, "it")) {
-          pkmn.language = LANGUAGE_ITALIAN;
-        } else if(!strcmp(optarg, "de")) {
-          pkmn.language = LANGUAGE_GERMAN;
-        } else if(!strcmp(optarg, "ko")) {
-          pkmn.language = LANGUAGE_KOREAN;
-        } else if(!strcmp(optarg, "es")) {
-          pkmn.language = LANGUAGE_SPANISH;
-        } else {
-          fputs("language must be one of ja|en|fr|it|de|ko|es\n", stderr);
-          return 1;
-        }
+    case OPT_RANDOM: // random corpus
+      random_count = strtoull(optarg, NULL, 0);
+      if(random_count == 0) {
+        fputs("random count must be at least 1\n", stderr);
+        return 1;
       }
       break;
-    case 'l': // pokemon level (recalculated on game save/load)
-      pkmn.level = (uint8_t) atoi(optarg);
+    case OPT_RANDOM_SEED: // seed of the random corpus
+      random_seed = strtoull(optarg, NULL, 0);
+      random_seed_set = true;
       break;
-    case 'Y': // pokérus remaining cache
-      pkmn.pokerus = (uint8_t) atoi(optarg);
+    case OPT_RANDOM_FIRST: // where in the random corpus to start
+      random_first = strtoull(optarg, NULL, 0);
       break;
-    case 'L': // current health
-      pkmn.current_health = (uint16_t) atoi(optarg);
+    case OPT_EXTRACT: // pokémon from an archive
+      extract_file = optarg;
       break;
-    case 'n': // max health cache
-      pkmn.max_health = (uint16_t) atoi(optarg);
+    case OPT_FIRST: // where in the archive to start
+      first = strtoull(optarg, NULL, 0);
       break;
-    case 'q': // attack cache
-      pkmn.attack = (uint16_t) atoi(optarg);
+    case OPT_QUERY: // filter records, saves and archives
+      if(!pokegen_query_parse(&query, optarg)) return !library_error();
+      query_set = true;
       break;
-    case 'u': // defense cache
-      pkmn.defense = (uint16_t) atoi(optarg);
-      break;
-    case 'I': // speed cache
-      pkmn.speed = (uint16_t) atoi(optarg);
-      break;
-    case 'Q': // special attack cache
-      pkmn.special_attack = (uint16_t) atoi(optarg);
-      break;
-    case 'U': // special defense cache
-      pkmn.special_defense = (uint16_t) atoi(optarg);
-      break;
-    case 'o': // dump raw
-      dump = false;
-      break;
-    case 'O': // hexdump
-      dump = true;
+    case OPT_FILL_BOXES: // bulk PC box filling
+      fill = atol(optarg);
+      if(fill < 1 || fill > BOXES * BOX_SIZE) {
+        fputs("fill-boxes count must be between 1-420\n", stderr);
+        return 1;
+      }
       break;
     case 'h':
-    default:
-      fprintf(stderr, usage, argv[0]);
+    case '?':
+      fprintf(stderr, usage, argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0],
+              argv[0], argv[0], argv[0], argv[0]);
       return 0;
+    default:
+      if(!pokegen_spec_set(&spec, c, optarg)) return !library_error();
     }
   }
 
-  // check that positional arguments are present
-  if(argc < optind + 2) {
-    fprintf(stderr, usage, argv[0]);
-    return 1;
+  if(decode) {
+    FILE *input = stdin;
+    if(decode_file != NULL && (input = fopen(decode_file, "rb")) == NULL) {
+      perror(decode_file);
+      return 1;
+    }
+
+    int status = decode_run(input, &out, json, check);
+    if(input != stdin) fclose(input);
+    return status;
+  }
+
+  if(query_set) {
+    return query_run(&query, &argv[optind], (size_t) (argc - optind), &out, json,
+                     threads > 0 ? (unsigned) threads : 1);
+  }
+
+  if(scan_file != NULL) {
+    return scan_run(scan_file, &out, json, threads > 0 ? (unsigned) threads : 1);
+  }
+
+  if(find_pid) {
+    if(pid_query.shiny_set && !spec.trainer_id_set) {
+      fputs("shininess depends on the trainer ID; set it with --trainer\n", stderr);
+      return 1;
+    }
+
+    unsigned long found;
+    pid_query.trainer_id = spec.pkmn.trainer_id;
+    if(!pokegen_pid_search(&pid_query, limit, threads > 0 ? (unsigned) threads : 1,
+                           stdout, &found)) {
+      return !library_error();
+    }
+    return 0;
   }
 
-  // copy positional arguments  
-  char nickname[NICKNAME_LENGTH], trainer_name[TRAINER_NAME_LENGTH];
+  if(find_seed) {
+    uint32_t seeds[64];
+    uint8_t methods[64];
+
+    if(!spec.personality_set) {
+      fputs("set the personality to find seeds for with --personality\n", stderr);
+      return 1;
+    }
+
+    size_t found = pokegen_lcg_find_seeds(spec.pkmn.personality, &spec.misc.ivs,
+                                          seeds, methods, 64);
+    for(size_t i = 0; i < found && i < 64; i++) {
+      printf("seed=0x%08lx method=%u\n", (unsigned long) seeds[i], methods[i]);
+    }
+    return found > 0 ? 0 : 1;
+  }
+
+  if(stand_in != 0) {
+    if(!output_start(&output)) return 1;
+
+    int status = stand_in_run(&output, (size_t) stand_in);
+    if(!output_finish(&output) || !outbuf_flush(&out)) status = 1;
+    return status;
+  }
 
-  strncpy(nickname, argv[optind], NICKNAME_LENGTH);
-  strncpy(trainer_name, argv[optind + 1], TRAINER_NAME_LENGTH);
+  // check that positional arguments are present
+  if(argc >= optind + 2) {
+    // copy positional arguments, which must fit rather than be cut short
+    if(strlen(argv[optind]) >= sizeof(spec.nickname)) {
+      fprintf(stderr, "pokémon name is longer than %zu bytes\n", sizeof(spec.nickname) - 1);
+      return 1;
+    } else if(strlen(argv[optind + 1]) >= sizeof(spec.trainer_name)) {
+      fprintf(stderr, "trainer name is longer than %zu bytes\n",
+              sizeof(spec.trainer_name) - 1);
+      return 1;
+    }
+    strcpy(spec.nickname, argv[optind]);
+    strcpy(spec.trainer_name, argv[optind + 1]);
+  } else if(!batch && fill == 0 && random_count == 0 && extract_file == NULL &&
+            serve_path == NULL) {
+    fprintf(stderr, usage, argv[0], argv[0], argv[0], argv[0], argv[0], argv[0], argv[0],
+              argv[0], argv[0], argv[0], argv[0]);
+    return 1;
+  }
 
-  // Finalize structure
-  assert(pcsconv(nickname, NICKNAME_LENGTH, LANGUAGE_ENGLISH) == true);
-  memcpy(pkmn.nickname, nickname, NICKNAME_LENGTH);
+  if(fill != 0) {
+    if(save_file == NULL) {
+      fputs("--fill-boxes needs a save file to fill\n", stderr);
+      return 1;
+    } else if(!slot_set) {
+      slot = (struct SaveSlot) {.box = true, .index = 0};
+    }
+  }
 
-  assert(pcsconv(trainer_name, TRAINER_NAME_LENGTH, LANGUAGE_ENGLISH) == true);
-  memcpy(pkmn.trainer_name, trainer_name, TRAINER_NAME_LENGTH);
+  if(serve_path != NULL) {
+    return serve_run(&spec, serve_path, threads > 0 ? (unsigned) threads : 1, rng);
+  }
 
-  pkmn.checksum = data_encrypt_to(
-    pkmn.data,
-    pkmn.personality,
-    pkmn.trainer_id,
-    growth,
-    attacks,
-    condition,
-    misc
-  );
+  struct Save save;
+  output.slot = slot;
+  if(save_file != NULL) {
+    if(!pokegen_save_open(&save, save_file, true)) return !library_error();
+    output.save = &save;
+  } else if(!output_start(&output)) {
+    return 1;
+  }
 
-  if(dump) {
-    hexdump(&pkmn, sizeof(struct Pokemon), 0x03004360 + 100);
+  int status = 0;
+  if(batch) {
+    FILE *input = stdin;
+    if(batch_file != NULL && (input = fopen(batch_file, "r")) == NULL) {
+      perror(batch_file);
+      status = 1;
+    } else {
+      status = batch_run(&spec, &rng, input, &output);
+      if(input != stdin) fclose(input);
+    }
+  } else if(fill != 0) {
+    status = fill_run(&spec, &rng, (size_t) fill, &output);
+  } else if(extract_file != NULL) {
+    status = extract_run(extract_file, first, limit, &output);
+  } else if(random_count != 0) {
+    if(!random_seed_set) {
+      random_seed = ((uint64_t) pokegen_random(&rng) << 32) | pokegen_random(&rng);
+      fprintf(stderr, "random seed %llu\n", random_seed);
+    }
+    status = random_run(&spec, random_seed, random_first, random_count,
+                        threads > 0 ? (unsigned) threads : 1, &output);
   } else {
-    fwrite(&pkmn, sizeof(struct Pokemon), 1, stdout);
+    // Finalize structure
+    struct Pokemon pkmn;
+    if(!pokegen_build(&spec, &rng, &pkmn)) {
+      status = !library_error();
+    } else {
+      pokegen_encode(&pkmn, 1);
+      if(!output_write(&output, &pkmn, 1, 0)) status = 1;
+    }
+  }
+
+  if(output.save != NULL) {
+    if(!pokegen_save_close(output.save)) status = !library_error();
+  } else if(!output_finish(&output)) {
+    status = 1;
   }
+  if(!outbuf_flush(&out)) status = 1;
+  return status;
 }